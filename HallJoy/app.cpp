@@ -32,8 +32,11 @@
 #include "app_paths.h"
 #include "ui_theme.h"
 #include "debug_log.h"
+#include "flight_recorder.h"
+#include "persist_worker.h"
 #include "mouse_ipc.h"
 #include "mouse_bind_codes.h"
+#include "keycode_tables.h"
 
 #pragma comment(lib, "Comctl32.lib")
 static constexpr UINT WM_APP_REQUEST_SAVE = WM_APP + 1;
@@ -43,6 +46,9 @@ static constexpr UINT WM_APP_KEYBOARD_LAYOUT_CHANGED = WM_APP + 260;
 // UI refresh timer
 static const UINT_PTR UI_TIMER_ID = 2;
 
+// Ctrl+Alt+F12: dump the flight recorder (recent ticks) next to the exe
+static const int FLIGHT_DUMP_HOTKEY_ID = 1;
+
 // Debounced settings save timer
 static const UINT_PTR SETTINGS_SAVE_TIMER_ID = 3;
 static const UINT SETTINGS_SAVE_TIMER_MS = 350;
@@ -77,14 +83,24 @@ static bool NeedMouseHookNow()
 
 static void RefreshLowLevelHooks()
 {
+    if (g_hKeyboardHook && Backend_ConsumeKeyboardHookLost())
+    {
+        // Windows dropped the hook after a timeout; the handle is stale.
+        UnhookWindowsHookEx(g_hKeyboardHook);
+        g_hKeyboardHook = nullptr;
+        DebugLog_Write(L"[app] keyboard hook lost, reinstalling");
+    }
+
     const bool wantKb = NeedKeyboardHookNow();
     if (wantKb && !g_hKeyboardHook)
     {
         g_hKeyboardHook = SetWindowsHookExW(WH_KEYBOARD_LL, KeyboardBlockHookProc, GetModuleHandleW(nullptr), 0);
+        Backend_SetKeyboardHookActive(g_hKeyboardHook != nullptr);
         DebugLog_Write(L"[app] keyboard hook install=%p", g_hKeyboardHook);
     }
     else if (!wantKb && g_hKeyboardHook)
     {
+        Backend_SetKeyboardHookActive(false);
         UnhookWindowsHookEx(g_hKeyboardHook);
         g_hKeyboardHook = nullptr;
         DebugLog_Write(L"[app] keyboard hook removed");
@@ -109,19 +125,25 @@ static void SaveSettingsByActiveGlobalProfile()
     const std::wstring& active = GlobalProfiles_GetActiveName();
     if (GlobalProfiles_IsDefault(active))
     {
-        SettingsIni_Save(AppPaths_SettingsIni().c_str());
+        PersistWorker_SaveSettings(AppPaths_SettingsIni());
         return;
     }
 
     // IMPORTANT:
     // When non-default profile is active, do NOT overwrite base settings.ini with
     // runtime values from that profile, otherwise "Default" profile gets polluted.
-    // Keep only active profile marker in base file.
-    GlobalProfiles_SaveActiveToSettingsIni(AppPaths_SettingsIni().c_str());
+    // Keep only the startup profile marker in base file (the manual choice, not
+    // an auto-selected profile). That is a read-modify-write, so it is done
+    // synchronously (after pending writes land) and only when the file may not
+    // hold the current marker.
+    if (!GlobalProfiles_IsMarkerCurrent())
+    {
+        PersistWorker_Flush();
+        GlobalProfiles_SaveStartupToSettingsIni(AppPaths_SettingsIni().c_str());
+    }
 
     // Active profile stores all runtime settings except layout/window.
-    std::wstring profileSettingsPath = AppPaths_ActiveSettingsIni();
-    SettingsIni_SaveProfile(profileSettingsPath.c_str());
+    PersistWorker_SaveSettingsProfile(AppPaths_ActiveSettingsIni());
 }
 
 static bool IsWindowRectVisibleOnAnyScreen(int x, int y, int w, int h)
@@ -245,129 +267,12 @@ static void UpdateMouseCursorLockState(bool blockNow)
 
 static uint16_t HidFromKeyboardScanCode(DWORD scanCode, bool extended, DWORD vkCode)
 {
-    switch (scanCode & 0xFFu)
-    {
-    case 0x01: return 41; // Esc
-    case 0x02: return 30; // 1
-    case 0x03: return 31; // 2
-    case 0x04: return 32; // 3
-    case 0x05: return 33; // 4
-    case 0x06: return 34; // 5
-    case 0x07: return 35; // 6
-    case 0x08: return 36; // 7
-    case 0x09: return 37; // 8
-    case 0x0A: return 38; // 9
-    case 0x0B: return 39; // 0
-    case 0x0C: return 45; // -
-    case 0x0D: return 46; // =
-    case 0x0E: return 42; // Backspace
-    case 0x0F: return 43; // Tab
-    case 0x10: return 20; // Q
-    case 0x11: return 26; // W
-    case 0x12: return 8;  // E
-    case 0x13: return 21; // R
-    case 0x14: return 23; // T
-    case 0x15: return 28; // Y
-    case 0x16: return 24; // U
-    case 0x17: return 12; // I
-    case 0x18: return 18; // O
-    case 0x19: return 19; // P
-    case 0x1A: return 47; // [
-    case 0x1B: return 48; // ]
-    case 0x1C: return extended ? 88 : 40; // Enter / Numpad Enter
-    case 0x1D: return extended ? 228 : 224; // RCtrl / LCtrl
-    case 0x1E: return 4;  // A
-    case 0x1F: return 22; // S
-    case 0x20: return 7;  // D
-    case 0x21: return 9;  // F
-    case 0x22: return 10; // G
-    case 0x23: return 11; // H
-    case 0x24: return 13; // J
-    case 0x25: return 14; // K
-    case 0x26: return 15; // L
-    case 0x27: return 51; // ;
-    case 0x28: return 52; // '
-    case 0x29: return 53; // `
-    case 0x2A: return 225; // LShift
-    case 0x2B: return 49; // Backslash
-    case 0x2C: return 29; // Z
-    case 0x2D: return 27; // X
-    case 0x2E: return 6;  // C
-    case 0x2F: return 25; // V
-    case 0x30: return 5;  // B
-    case 0x31: return 17; // N
-    case 0x32: return 16; // M
-    case 0x33: return 54; // ,
-    case 0x34: return 55; // .
-    case 0x35: return extended ? 84 : 56; // Numpad / or /
-    case 0x36: return 229; // RShift
-    case 0x37: return extended ? 70 : 85; // PrintScreen / Numpad *
-    case 0x38: return extended ? 230 : 226; // RAlt / LAlt
-    case 0x39: return 44; // Space
-    case 0x3A: return 57; // CapsLock
-    case 0x3B: return 58; // F1
-    case 0x3C: return 59; // F2
-    case 0x3D: return 60; // F3
-    case 0x3E: return 61; // F4
-    case 0x3F: return 62; // F5
-    case 0x40: return 63; // F6
-    case 0x41: return 64; // F7
-    case 0x42: return 65; // F8
-    case 0x43: return 66; // F9
-    case 0x44: return 67; // F10
-    case 0x45: return 83; // NumLock
-    case 0x46: return 71; // ScrollLock
-    case 0x47: return extended ? 74 : 95; // Home / Numpad 7
-    case 0x48: return extended ? 82 : 96; // Up / Numpad 8
-    case 0x49: return extended ? 75 : 97; // PgUp / Numpad 9
-    case 0x4A: return 86; // Numpad -
-    case 0x4B: return extended ? 80 : 92; // Left / Numpad 4
-    case 0x4C: return 93; // Numpad 5
-    case 0x4D: return extended ? 79 : 94; // Right / Numpad 6
-    case 0x4E: return 87; // Numpad +
-    case 0x4F: return extended ? 77 : 89; // End / Numpad 1
-    case 0x50: return extended ? 81 : 90; // Down / Numpad 2
-    case 0x51: return extended ? 78 : 91; // PgDn / Numpad 3
-    case 0x52: return extended ? 73 : 98; // Insert / Numpad 0
-    case 0x53: return extended ? 76 : 99; // Delete / Numpad .
-    case 0x57: return 68; // F11
-    case 0x58: return 69; // F12
-    case 0x5B: return 227; // LWin
-    case 0x5C: return 231; // RWin
-    case 0x5D: return 101; // Menu/App
-    default:
-        break;
-    }
+    uint16_t hid = KeycodeTables::HidFromScan1(scanCode & 0xFFu, extended);
 
     // Fallback for rare events with zero/unknown scan code.
-    switch (vkCode)
-    {
-    case 'A': return 4; case 'B': return 5; case 'C': return 6; case 'D': return 7; case 'E': return 8;
-    case 'F': return 9; case 'G': return 10; case 'H': return 11; case 'I': return 12; case 'J': return 13;
-    case 'K': return 14; case 'L': return 15; case 'M': return 16; case 'N': return 17; case 'O': return 18;
-    case 'P': return 19; case 'Q': return 20; case 'R': return 21; case 'S': return 22; case 'T': return 23;
-    case 'U': return 24; case 'V': return 25; case 'W': return 26; case 'X': return 27; case 'Y': return 28;
-    case 'Z': return 29;
-    case '1': return 30; case '2': return 31; case '3': return 32; case '4': return 33; case '5': return 34;
-    case '6': return 35; case '7': return 36; case '8': return 37; case '9': return 38; case '0': return 39;
-    case VK_SPACE: return 44;
-    case VK_TAB: return 43;
-    case VK_RETURN: return extended ? 88 : 40;
-    case VK_BACK: return 42;
-    case VK_ESCAPE: return 41;
-    case VK_LEFT: return 80;
-    case VK_RIGHT: return 79;
-    case VK_UP: return 82;
-    case VK_DOWN: return 81;
-    case VK_HOME: return 74;
-    case VK_END: return 77;
-    case VK_PRIOR: return 75;
-    case VK_NEXT: return 78;
-    case VK_INSERT: return 73;
-    case VK_DELETE: return 76;
-    default:
-        return 0;
-    }
+    if (hid == 0)
+        hid = KeycodeTables::HidFromVk(vkCode, extended);
+    return hid;
 }
 
 static LRESULT CALLBACK KeyboardBlockHookProc(int nCode, WPARAM wParam, LPARAM lParam)
@@ -591,6 +496,11 @@ static LRESULT CALLBACK MainWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
             }
         }
 
+        FlightRecorder_Init();
+        PersistWorker_Init();
+        if (!RegisterHotKey(hwnd, FLIGHT_DUMP_HOTKEY_ID, MOD_CONTROL | MOD_ALT | MOD_NOREPEAT, VK_F12))
+            DebugLog_Write(L"[app] flight dump hotkey register failed err=%lu", GetLastError());
+
         if (g_backendReady)
             RealtimeLoop_Start();
         ApplyTimingSettings(hwnd);
@@ -699,6 +609,14 @@ static LRESULT CALLBACK MainWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
         }
         return 0;
 
+    case WM_HOTKEY:
+        if (wParam == FLIGHT_DUMP_HOTKEY_ID)
+        {
+            DebugLog_Write(L"[app] flight dump requested by hotkey");
+            FlightRecorder_RequestDump(FlightDumpReason_Hotkey);
+        }
+        return 0;
+
     case WM_APP_REQUEST_SAVE:
         RequestSettingsSave(hwnd);
         return 0;
@@ -717,6 +635,7 @@ static LRESULT CALLBACK MainWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
         g_mouseBlockPauseByRShift.store(false, std::memory_order_relaxed);
         UpdateMouseCursorLockState(false);
         MouseIpc_ShutdownPublisher();
+        UnregisterHotKey(hwnd, FLIGHT_DUMP_HOTKEY_ID);
         KillTimer(hwnd, UI_TIMER_ID);
         KillTimer(hwnd, SETTINGS_SAVE_TIMER_ID);
 
@@ -746,6 +665,8 @@ static LRESULT CALLBACK MainWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
             Backend_Shutdown();
             g_backendReady = false;
         }
+        PersistWorker_Shutdown();
+        FlightRecorder_Shutdown();
         PostQuitMessage(0);
         return 0;
     }
@@ -887,6 +808,7 @@ int App_Run(HINSTANCE hInst, int nCmdShow)
 
     if (g_hKeyboardHook)
     {
+        Backend_SetKeyboardHookActive(false);
         UnhookWindowsHookEx(g_hKeyboardHook);
         g_hKeyboardHook = nullptr;
     }
@@ -20,6 +20,12 @@ const std::wstring& AppPaths_GlobalProfilesDir()
     return p;
 }
 
+const std::wstring& AppPaths_AutoProfilesIni()
+{
+    static std::wstring p = WinUtil_BuildPathNearExe(L"autoprofiles.ini");
+    return p;
+}
+
 std::wstring AppPaths_ActiveSettingsIni()
 {
     return GlobalProfiles_GetSettingsPath(GlobalProfiles_GetActiveName());
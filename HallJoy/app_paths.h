@@ -6,5 +6,6 @@
 const std::wstring& AppPaths_SettingsIni();
 const std::wstring& AppPaths_BindingsIni();
 const std::wstring& AppPaths_GlobalProfilesDir();
+const std::wstring& AppPaths_AutoProfilesIni();
 std::wstring AppPaths_ActiveSettingsIni();
 std::wstring AppPaths_ActiveBindingsIni();
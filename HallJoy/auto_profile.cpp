@@ -0,0 +1,157 @@
+// auto_profile.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "auto_profile.h"
+#include "app_paths.h"
+#include "auto_profile_rules.h"
+#include "debug_log.h"
+#include "foreground_watch.h"
+#include "global_profiles.h"
+#include "ini_doc.h"
+#include "profile_cache.h"
+#include "profile_stage.h"
+
+static AutoProfileRules g_rules;
+static bool g_running = false;
+static HWND g_notifyWnd = nullptr;
+static UINT g_notifyMsg = 0;
+
+static std::wstring g_requested; // last profile the foreground asked for
+
+// Folded profile name -> decoded image.
+static std::unordered_map<std::wstring, std::unique_ptr<ProfileImage>> g_images;
+
+static std::wstring Key(const std::wstring& name)
+{
+    std::wstring k = GlobalProfiles_SanitizeName(name);
+    if (k.empty() || GlobalProfiles_IsDefault(k)) return L"default";
+    CharLowerBuffW(k.data(), (DWORD)k.size());
+    return k;
+}
+
+static bool SameProfile(const std::wstring& a, const std::wstring& b)
+{
+    return Key(a) == Key(b);
+}
+
+static void Preload(const std::wstring& name)
+{
+    const std::wstring k = Key(name);
+    if (g_images.count(k)) return;
+
+    auto img = std::make_unique<ProfileImage>();
+    ProfileCacheResult r = ProfileCache_ReadImage(GlobalProfiles_GetSettingsPath(name).c_str(),
+        GlobalProfiles_GetBindingsPath(name).c_str(), img.get());
+    if (r == ProfileCacheResult::Hit)
+        g_images.emplace(k, std::move(img));
+
+    // Miss: first switch goes through the staged loader, which rebuilds the
+    // cache; leaving the profile later captures it here.
+    DebugLog_Write(L"[autoprofile] preload profile=%s result=%d", name.c_str(), (int)r);
+}
+
+static void OnForegroundChanged(const std::wstring& exePath, void*)
+{
+    const AutoProfileRule* rule = g_rules.Match(exePath);
+    // No rule: back to the manual choice (the startup profile).
+    std::wstring want = rule ? rule->profile : GlobalProfiles_GetStartupName();
+    if (want.empty()) return;
+
+    DebugLog_Write(L"[autoprofile] foreground=%s rule=%s want=%s",
+        exePath.c_str(), rule ? rule->exe.c_str() : L"-", want.c_str());
+
+    g_requested = want;
+    if (!SameProfile(want, GlobalProfiles_GetActiveName()) && g_notifyWnd)
+        PostMessageW(g_notifyWnd, g_notifyMsg, 0, 0);
+}
+
+void AutoProfile_Init(HWND notifyWnd, UINT notifyMsg)
+{
+    AutoProfile_Shutdown();
+
+    g_notifyWnd = notifyWnd;
+    g_notifyMsg = notifyMsg;
+
+    IniDoc ini;
+    if (!ini.Load(AppPaths_AutoProfilesIni().c_str()))
+        return;
+    if (ini.GetInt(L"Main", L"Enabled", 1) == 0)
+        return;
+
+    g_rules.Clear();
+    if (const auto* rules = ini.Section(L"Rules"))
+    {
+        for (const IniDoc::Entry& e : *rules)
+            g_rules.Add(e.key, e.value);
+    }
+    if (g_rules.Rules().empty())
+        return;
+
+    for (const AutoProfileRule& r : g_rules.Rules())
+        Preload(r.profile);
+    Preload(GlobalProfiles_GetStartupName());
+
+    g_running = ForegroundWatch_Start(OnForegroundChanged, nullptr);
+    DebugLog_Write(L"[autoprofile] init rules=%d preloaded=%d running=%d",
+        (int)g_rules.Rules().size(), (int)g_images.size(), g_running ? 1 : 0);
+}
+
+void AutoProfile_Shutdown()
+{
+    if (g_running)
+        ForegroundWatch_Stop();
+    g_running = false;
+    g_rules.Clear();
+    g_images.clear();
+    g_requested.clear();
+    g_notifyWnd = nullptr;
+}
+
+bool AutoProfile_TakeRequest(std::wstring* outName)
+{
+    if (!outName || g_requested.empty()) return false;
+    if (SameProfile(g_requested, GlobalProfiles_GetActiveName())) return false;
+    *outName = g_requested;
+    return true;
+}
+
+bool AutoProfile_IsPreloaded(const std::wstring& name)
+{
+    return g_images.count(Key(name)) != 0;
+}
+
+bool AutoProfile_PublishPreloaded(const std::wstring& name)
+{
+    auto it = g_images.find(Key(name));
+    if (it == g_images.end()) return false;
+    ProfileStage_PublishImage(*it->second);
+    return true;
+}
+
+void AutoProfile_CaptureActive()
+{
+    if (!g_running) return;
+
+    auto& slot = g_images[Key(GlobalProfiles_GetActiveName())];
+    if (!slot) slot = std::make_unique<ProfileImage>();
+    ProfileCache_CaptureImage(slot.get());
+}
+
+void AutoProfile_SetManualProfile(const std::wstring& name)
+{
+    GlobalProfiles_SetStartupName(name);
+    // A hand pick overrides the current rule until the next focus change.
+    g_requested.clear();
+}
+
+void AutoProfile_Forget(const std::wstring& name)
+{
+    g_images.erase(Key(name));
+    if (SameProfile(GlobalProfiles_GetStartupName(), name))
+        GlobalProfiles_SetStartupName(L"Default");
+}
@@ -0,0 +1,41 @@
+// auto_profile.h
+#pragma once
+#include <windows.h>
+#include <string>
+
+// Foreground-application profile auto-switching.
+//
+// Rules live in autoprofiles.ini next to the exe:
+//   [Main]  Enabled=1
+//   [Rules] eldenring.exe=Souls
+//           C:\Games\Forza\forza.exe=Racing
+// When the foreground process matches a rule, that global profile becomes
+// active; when nothing matches, the profile the user picked by hand comes back.
+//
+// Every profile a rule (or the manual choice) refers to is kept decoded in
+// memory, so a focus change publishes it without touching disk. The image of
+// the profile being left is re-captured from runtime state on every switch,
+// so edits made while it was active are kept.
+//
+// UI thread only.
+
+// Loads rules, preloads profiles and starts the foreground watcher. On a
+// change, posts `notifyMsg` to `notifyWnd`; the window then calls
+// AutoProfile_TakeRequest and switches. No-op if disabled or no rules.
+void AutoProfile_Init(HWND notifyWnd, UINT notifyMsg);
+void AutoProfile_Shutdown();
+
+// Profile the foreground currently asks for; false if it is already active.
+bool AutoProfile_TakeRequest(std::wstring* outName);
+
+// True if `name` is preloaded (AutoProfile_PublishPreloaded will not hit disk).
+bool AutoProfile_IsPreloaded(const std::wstring& name);
+// Publishes a preloaded profile in one config swap. False if not preloaded.
+bool AutoProfile_PublishPreloaded(const std::wstring& name);
+
+// Call right before the active profile is switched away from (manual or auto).
+void AutoProfile_CaptureActive();
+// The user's own choice, restored when no rule matches.
+void AutoProfile_SetManualProfile(const std::wstring& name);
+// Drops a deleted profile's image.
+void AutoProfile_Forget(const std::wstring& name);
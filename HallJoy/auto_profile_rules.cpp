@@ -0,0 +1,70 @@
+// auto_profile_rules.cpp
+#include "auto_profile_rules.h"
+
+#include <cwctype>
+
+static std::wstring Normalize(std::wstring_view s)
+{
+    std::wstring out;
+    out.reserve(s.size());
+    for (wchar_t c : s)
+        out.push_back(c == L'/' ? L'\\' : (wchar_t)std::towlower((wint_t)c));
+    return out;
+}
+
+static std::wstring_view Trim(std::wstring_view s)
+{
+    while (!s.empty() && (s.front() == L' ' || s.front() == L'\t' || s.front() == L'"')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == L' ' || s.back() == L'\t' || s.back() == L'"')) s.remove_suffix(1);
+    return s;
+}
+
+static std::wstring_view FileName(std::wstring_view path)
+{
+    size_t slash = path.find_last_of(L'\\');
+    return (slash == std::wstring_view::npos) ? path : path.substr(slash + 1);
+}
+
+void AutoProfileRules::Clear()
+{
+    m_rules.clear();
+    m_compiled.clear();
+}
+
+void AutoProfileRules::Add(std::wstring_view exe, std::wstring_view profile)
+{
+    exe = Trim(exe);
+    profile = Trim(profile);
+    if (exe.empty() || profile.empty()) return;
+
+    Compiled c;
+    c.key = Normalize(exe);
+    c.fullPath = (c.key.find(L'\\') != std::wstring::npos);
+
+    m_rules.push_back(AutoProfileRule{ std::wstring(exe), std::wstring(profile) });
+    m_compiled.push_back(std::move(c));
+}
+
+const AutoProfileRule* AutoProfileRules::Match(std::wstring_view exePath) const
+{
+    if (exePath.empty() || m_rules.empty()) return nullptr;
+
+    const std::wstring path = Normalize(exePath);
+    const std::wstring_view name = FileName(path);
+
+    const AutoProfileRule* byName = nullptr;
+    for (size_t i = 0; i < m_compiled.size(); ++i)
+    {
+        const Compiled& c = m_compiled[i];
+        if (c.fullPath)
+        {
+            if (c.key == path)
+                return &m_rules[i];
+        }
+        else if (!byName && c.key == name)
+        {
+            byName = &m_rules[i];
+        }
+    }
+    return byName;
+}
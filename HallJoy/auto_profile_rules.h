@@ -0,0 +1,41 @@
+// auto_profile_rules.h
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Foreground-process -> global profile rules. Plain C++ (no Win32), so the
+// matching can be exercised off Windows.
+//
+// `exe` is either a file name ("eldenring.exe"), matched against the last path
+// component, or a full path, matched against the whole image path. Both are
+// case-insensitive; '/' and '\' are equivalent. A full-path rule beats a
+// file-name rule; otherwise the first rule wins.
+struct AutoProfileRule
+{
+    std::wstring exe;
+    std::wstring profile;
+};
+
+class AutoProfileRules
+{
+public:
+    void Clear();
+    // Ignores rules with an empty exe or profile.
+    void Add(std::wstring_view exe, std::wstring_view profile);
+
+    // nullptr when no rule matches `exePath` (a full image path or a bare name).
+    const AutoProfileRule* Match(std::wstring_view exePath) const;
+
+    const std::vector<AutoProfileRule>& Rules() const { return m_rules; }
+
+private:
+    struct Compiled
+    {
+        std::wstring key; // folded, '/' -> '\'
+        bool fullPath = false;
+    };
+
+    std::vector<AutoProfileRule> m_rules;
+    std::vector<Compiled> m_compiled; // parallel to m_rules
+};
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <bitset>
 #include <cmath>
 #include <cstring>
@@ -33,28 +34,224 @@
 #include "bindings.h"
 #include "settings.h"
 #include "debug_log.h"
+#include "key_settings.h"
+#include "flight_recorder.h"
 #include "mouse_bind_codes.h"
 #include "backend_curve.h"
+#include "backend_digital.h"
+#include "backend_predict.h"
+#include "backend_smoothing.h"
+#include "keycode_tables.h"
 
 #pragma comment(lib, "setupapi.lib")
 #pragma comment(lib, "hid.lib")
 
 static PVIGEM_CLIENT g_client = nullptr;
-static constexpr int kMaxVirtualPads = 4;
+static constexpr int kMaxVirtualPads = BINDINGS_MAX_GAMEPADS;
 static std::array<PVIGEM_TARGET, kMaxVirtualPads> g_pads{};
 static std::atomic<int> g_virtualPadCount{ 1 };
 static std::atomic<bool> g_virtualPadsEnabled{ true };
 static int g_connectedPadCount = 0;
 
-static std::array<XUSB_REPORT, kMaxVirtualPads> g_reports{};
-static std::array<XUSB_REPORT, kMaxVirtualPads> g_lastSentReports{};
-static std::array<DWORD, kMaxVirtualPads> g_lastSentTicks{};
-static std::array<uint8_t, kMaxVirtualPads> g_lastSentValid{};
+// Realtime-thread state of one virtual pad, kept together so a tick only
+// touches the pads it actually builds.
+struct PadState
+{
+    XUSB_REPORT report{};
+    XUSB_REPORT lastSent{};
+    int64_t lastSentQpc = 0;
+    uint8_t lastSentValid = 0;
+
+    // Send pacing: a change held back by the minimum send interval. It goes out
+    // at pacedDueQpc (Backend_FlushPacedReports) unless a tick sends first.
+    uint8_t pacedPending = 0;
+    int64_t pacedDueQpc = 0;
+    XUSB_REPORT pacedReport{};
+
+    // Snappy Joystick (SOCD-like), one entry per axis (LX,LY,RX,RY)
+    std::array<uint8_t, 4> snappyPrevMinusDown{};
+    std::array<uint8_t, 4> snappyPrevPlusDown{};
+    std::array<int8_t, 4> snappyLastDir{}; // -1 = minus, +1 = plus, 0 = unknown
+    std::array<float, 4> snappyMinusValley{};
+    std::array<float, 4> snappyPlusValley{};
+};
+static std::array<PadState, kMaxVirtualPads> g_padState{};
+static int g_builtPadCount = 0; // pads built last tick; ones above the current count get zeroed once
+
+// ---- incremental tick (realtime thread) ----
+// A pad whose bound inputs read bit-identical to last tick, with no filter state
+// still moving, keeps last tick's report instead of re-running curves, SOCD and
+// the report build. Any settings / key settings / bindings / profile change
+// rebuilds everything once.
+struct IncrementalState
+{
+    bool valid = false; // false = next tick rebuilds every pad and tracked key
+    uint64_t settingsVersion = 0;
+    uint64_t keyGeneration = 0;
+    uint64_t bindingsGeneration = 0;
+    uint32_t configSeq = 0;
+    bool headless = false;
+};
+static IncrementalState g_incremental;
+
+// Per pad, refreshed on every full rebuild.
+struct PadInputs
+{
+    std::array<uint64_t, 4> bound{}; // HIDs < 256 bound to anything on the pad
+    bool alwaysRebuild = false;      // axis / trigger bound to an extended HID (>= 256)
+};
+static std::array<PadInputs, kMaxVirtualPads> g_padInputs{};
+
+// Raw bits of each HID as of the tick serial next to it.
+static uint32_t g_tickSerial = 0;
+static std::array<uint32_t, 256> g_prevRawBits{};
+static std::array<uint32_t, 256> g_prevRawSerial{};
+// Last curve output of each HID and the tick serial it is known current for
+// (computed then, or input unchanged since).
+static std::array<float, 256> g_lastFiltered{};
+static std::array<uint32_t, 256> g_lastFilteredSerial{};
 
 // Thread-safe last-report snapshot (writer: realtime thread, reader: UI thread)
 static std::array<std::atomic<uint32_t>, kMaxVirtualPads> g_lastSeq{};
 static std::array<XUSB_REPORT, kMaxVirtualPads> g_lastReport{};
+static std::array<uint32_t, kMaxVirtualPads> g_lastReportSum{}; // written with g_lastReport, same seq
 static std::array<std::atomic<SHORT>, kMaxVirtualPads> g_lastRX{};
+static std::atomic<uint64_t> g_lastReportRetries{ 0 };
+static std::atomic<uint64_t> g_lastReportTorn{ 0 };
+
+// Config publish bracket (writer: UI thread, see Backend_BeginConfigSwap). Odd while
+// a profile is being published; a tick that overlaps it keeps last tick's reports.
+static std::atomic<uint32_t> g_configSeq{ 0 };
+static std::atomic<uint64_t> g_configHeldTicks{ 0 };
+
+// ---- tick profiling (QPC units; writer: realtime thread) ----
+static std::array<std::atomic<int64_t>, BackendTickStage_Count> g_stageLastQpc{};
+static std::array<std::atomic<int64_t>, BackendTickStage_Count> g_stageTotalQpc{};
+static std::atomic<uint64_t>     g_profileTicks{ 0 };
+static std::atomic<uint64_t>     g_reportsSent{ 0 };
+static std::atomic<uint64_t>     g_reportsSuppressed{ 0 };
+static std::atomic<uint64_t>     g_padsRebuilt{ 0 };
+static std::atomic<uint64_t>     g_padsReused{ 0 };
+
+// ---- realtime progress markers (read by the realtime-loop watchdog) ----
+static std::atomic<uint64_t>     g_progressTicks{ 0 };
+static std::atomic<int>          g_progressStage{ -1 }; // -1 = between ticks
+static std::atomic<int>          g_progressCall{ BackendCall_None };
+static std::atomic<int64_t>      g_progressStageQpc{ 0 };
+static std::atomic<bool>         g_neutralizeInFlight{ false };
+static std::atomic<bool>         g_padsNeutralized{ false };    // watchdog sent zero reports; resend real state
+static SRWLOCK                   g_vigemLifecycleLock = SRWLOCK_INIT; // client/target create+destroy
+
+static inline void ProgressCall_Enter(BackendCall call)
+{
+    g_progressCall.store(call, std::memory_order_relaxed);
+}
+
+static inline void ProgressCall_Leave()
+{
+    g_progressCall.store(BackendCall_None, std::memory_order_relaxed);
+}
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+static double QpcToUs(int64_t qpc)
+{
+    static const double s_usPerTick = []() {
+        LARGE_INTEGER f{};
+        QueryPerformanceFrequency(&f);
+        return (f.QuadPart > 0) ? (1000000.0 / (double)f.QuadPart) : 0.0;
+    }();
+    return (double)qpc * s_usPerTick;
+}
+
+// ---- Wooting SDK per-API accounting (see WootingSafe_* wrappers) ----
+static constexpr int kWootingErrSeh = 1; // pseudo error code: SEH fault inside the SDK call
+
+struct WootingApiCounters
+{
+    std::atomic<uint64_t> calls{ 0 };
+    std::atomic<uint64_t> errors{ 0 };
+    std::atomic<int64_t>  totalQpc{ 0 };
+    std::atomic<int64_t>  worstQpc{ 0 };
+    std::atomic<uint32_t> thisTick{ 0 };
+    std::atomic<uint32_t> lastTick{ 0 };
+    std::atomic<uint32_t> maxPerTick{ 0 };
+    std::array<std::atomic<uint64_t>, kBackendWootingLatencyBuckets> latency{};
+    std::array<std::atomic<uint64_t>, kBackendWootingErrorSlots> errorCodes{};
+};
+
+static std::array<WootingApiCounters, BackendWootingApi_Count> g_wootingApiStats{};
+
+// Counters above have one writer (the realtime thread): no locked RMW per SDK call.
+template<typename T>
+static void WootingStat_Add(std::atomic<T>& a, T v)
+{
+    a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+}
+
+static int WootingLatencyBucket(double us)
+{
+    // [0,1) [1,2) [2,4) ... last bucket open-ended
+    uint32_t u = (uint32_t)std::clamp(us, 0.0, 4.0e9);
+    int b = 0;
+    while (u) { ++b; u >>= 1; }
+    return std::min(b, kBackendWootingLatencyBuckets - 1);
+}
+
+static int64_t WootingCall_Begin()
+{
+    ProgressCall_Enter(BackendCall_WootingSdk);
+    return QpcNow();
+}
+
+static void WootingCall_End(BackendWootingApi api, int64_t startQpc, int errorCode)
+{
+    int64_t d = QpcNow() - startQpc;
+    ProgressCall_Leave();
+
+    WootingApiCounters& c = g_wootingApiStats[(size_t)api];
+    WootingStat_Add<uint64_t>(c.calls, 1);
+    WootingStat_Add<uint32_t>(c.thisTick, 1);
+    WootingStat_Add<int64_t>(c.totalQpc, d);
+    if (d > c.worstQpc.load(std::memory_order_relaxed))
+        c.worstQpc.store(d, std::memory_order_relaxed);
+    WootingStat_Add<uint64_t>(c.latency[(size_t)WootingLatencyBucket(QpcToUs(d))], 1);
+
+    if (errorCode != 0)
+    {
+        WootingStat_Add<uint64_t>(c.errors, 1);
+        int slot = kBackendWootingErrorSlots - 1; // SEH fault / unknown
+        if (errorCode >= (int)WootingAnalogResult_UnInitialized && errorCode <= (int)WootingAnalogResult_DLLNotFound)
+            slot = errorCode - (int)WootingAnalogResult_UnInitialized;
+        WootingStat_Add<uint64_t>(c.errorCodes[(size_t)slot], 1);
+    }
+}
+
+// Realtime thread, once per tick: roll "calls this tick" into last/max.
+static void WootingStats_EndTick()
+{
+    for (auto& c : g_wootingApiStats)
+    {
+        uint32_t n = c.thisTick.load(std::memory_order_relaxed);
+        c.thisTick.store(0, std::memory_order_relaxed);
+        c.lastTick.store(n, std::memory_order_relaxed);
+        if (n > c.maxPerTick.load(std::memory_order_relaxed))
+            c.maxPerTick.store(n, std::memory_order_relaxed);
+    }
+}
+
+// ---- settings seen by the current tick (realtime thread only) ----
+// Loaded once at the start of Backend_Tick, see Settings_GetSnapshot.
+static SettingsSnapshot g_tickSettings{};
+
+// ---- headless mode (bench tools) ----
+static std::atomic<bool>         g_headless{ false };
+static std::array<std::atomic<uint16_t>, 256> g_simRawM{};
 
 // ---- UI snapshot ----
 static std::array<std::atomic<uint16_t>, 256> g_uiAnalogM{}; // filtered output (after curve)
@@ -69,6 +266,9 @@ static std::atomic<int>          g_trackedCount{ 0 };
 static std::atomic<bool>         g_bindCaptureEnabled{ false };
 static std::atomic<uint32_t>     g_bindCapturedPacked{ 0 }; // low16=hid, high16=rawMilli
 static std::atomic<bool>         g_bindHadDown{ false };
+static uint16_t                  g_bindLastHid = 0;             // realtime thread
+static uint32_t                  g_bindCaptureTicks = 0;        // realtime thread, ticks since capture began
+static constexpr uint32_t        kBindCaptureFullScanTicks = 32;
 
 // ---- status / reconnect ----
 static std::atomic<bool>         g_vigemOk{ false };
@@ -91,6 +291,16 @@ static std::atomic<uint16_t>     g_keyboardEventScan{ 0 };
 static std::atomic<uint16_t>     g_keyboardEventVk{ 0 };
 static std::array<std::atomic<uint16_t>, 256> g_hidToScan{};
 static std::array<std::atomic<uint16_t>, 256> g_hidToVk{};
+static std::atomic<uint32_t>     g_hidLearnSeq{ 0 };           // bumped when g_hidToScan / g_hidToVk change
+// Physical key state kept by the keyboard hook (Backend_NotifyKeyboardEvent), one
+// bit per HID. While the hook runs, digital fallback reads this instead of
+// calling GetAsyncKeyState per key per tick.
+static std::array<std::atomic<uint64_t>, 4> g_physicalDown{};
+static std::atomic<bool>         g_keyboardHookActive{ false };
+static std::atomic<ULONGLONG>    g_lastKeyboardHookEventMs{ 0 };
+static std::atomic<bool>         g_keyboardHookLost{ false };     // for the UI thread to reinstall
+static ULONGLONG                 g_physicalVerifyMs = 0;         // realtime thread
+static std::array<uint64_t, 4>   g_physicalVerifySuspect{};     // realtime thread
 static std::atomic<ULONGLONG>    g_lastFullBufferLogMs{ 0 };
 static std::atomic<int>          g_zeroProbeStreak{ 0 };
 static std::atomic<bool>         g_autoRecoverTried{ false };
@@ -166,126 +376,180 @@ static int WootingSafe_Initialise()
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (int)WootingAnalogResult_Failure;
+    int r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_initialise();
+        r = wooting_analog_initialise();
     }
     __except (WootingSdk_SehFilterCritical(L"wooting_analog_initialise", GetExceptionCode()))
     {
-        return (int)WootingAnalogResult_Failure;
+        r = (int)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_Initialise, t0, seh ? kWootingErrSeh : ((r < 0) ? r : 0));
+    return r;
 }
 
 static bool WootingSafe_IsInitialised()
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return false;
+    bool r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_is_initialised();
+        r = wooting_analog_is_initialised();
     }
     __except (WootingSdk_SehFilterCritical(L"wooting_analog_is_initialised", GetExceptionCode()))
     {
-        return false;
+        r = false;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_IsInitialised, t0, seh ? kWootingErrSeh : (0));
+    return r;
 }
 
 static WootingAnalogResult WootingSafe_Uninitialise()
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return WootingAnalogResult_Failure;
+    WootingAnalogResult r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_uninitialise();
+        r = wooting_analog_uninitialise();
     }
     __except (WootingSdk_SehFilterCritical(L"wooting_analog_uninitialise", GetExceptionCode()))
     {
-        return WootingAnalogResult_Failure;
+        r = WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_Uninitialise, t0, seh ? kWootingErrSeh : ((r != WootingAnalogResult_Ok) ? (int)r : 0));
+    return r;
 }
 
 static WootingAnalogResult WootingSafe_SetKeycodeMode(WootingAnalog_KeycodeType mode)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return WootingAnalogResult_UnInitialized;
+    WootingAnalogResult r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_set_keycode_mode(mode);
+        r = wooting_analog_set_keycode_mode(mode);
     }
     __except (WootingSdk_SehFilterCritical(L"wooting_analog_set_keycode_mode", GetExceptionCode()))
     {
-        return WootingAnalogResult_Failure;
+        r = WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_SetKeycodeMode, t0, seh ? kWootingErrSeh : ((r != WootingAnalogResult_Ok) ? (int)r : 0));
+    return r;
 }
 
 static int WootingSafe_GetConnectedDevicesInfo(WootingAnalog_DeviceInfo_FFI** buffer, unsigned int len)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (int)WootingAnalogResult_UnInitialized;
+    int r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_get_connected_devices_info(buffer, len);
+        r = wooting_analog_get_connected_devices_info(buffer, len);
     }
     __except (WootingSdk_SehFilterOptional(L"wooting_analog_get_connected_devices_info", GetExceptionCode()))
     {
-        return (int)WootingAnalogResult_Failure;
+        r = (int)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_GetConnectedDevicesInfo, t0, seh ? kWootingErrSeh : ((r < 0) ? r : 0));
+    return r;
 }
 
 static float WootingSafe_ReadAnalog(unsigned short code)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (float)WootingAnalogResult_UnInitialized;
+    float r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_read_analog(code);
+        r = wooting_analog_read_analog(code);
     }
     __except (WootingSdk_SehFilterCritical(L"wooting_analog_read_analog", GetExceptionCode()))
     {
-        return (float)WootingAnalogResult_Failure;
+        r = (float)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_ReadAnalog, t0, seh ? kWootingErrSeh : ((r < 0.0f) ? (int)r : 0));
+    return r;
 }
 
 static float WootingSafe_ReadAnalogDevice(unsigned short code, WootingAnalog_DeviceID deviceId)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (float)WootingAnalogResult_UnInitialized;
+    float r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_read_analog_device(code, deviceId);
+        r = wooting_analog_read_analog_device(code, deviceId);
     }
     __except (WootingSdk_SehFilterOptional(L"wooting_analog_read_analog_device", GetExceptionCode()))
     {
-        return (float)WootingAnalogResult_Failure;
+        r = (float)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_ReadAnalogDevice, t0, seh ? kWootingErrSeh : ((r < 0.0f) ? (int)r : 0));
+    return r;
 }
 
 static int WootingSafe_ReadFullBuffer(unsigned short* codeBuffer, float* analogBuffer, unsigned int len)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (int)WootingAnalogResult_UnInitialized;
+    int r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_read_full_buffer(codeBuffer, analogBuffer, len);
+        r = wooting_analog_read_full_buffer(codeBuffer, analogBuffer, len);
     }
     __except (WootingSdk_SehFilterOptional(L"wooting_analog_read_full_buffer", GetExceptionCode()))
     {
-        return (int)WootingAnalogResult_Failure;
+        r = (int)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_ReadFullBuffer, t0, seh ? kWootingErrSeh : ((r < 0) ? r : 0));
+    return r;
 }
 
 static int WootingSafe_ReadFullBufferDevice(unsigned short* codeBuffer, float* analogBuffer, unsigned int len, WootingAnalog_DeviceID deviceId)
 {
     if (g_wootingSdkFaulted.load(std::memory_order_acquire))
         return (int)WootingAnalogResult_UnInitialized;
+    int r{};
+    bool seh = false;
+    const int64_t t0 = WootingCall_Begin();
     __try
     {
-        return wooting_analog_read_full_buffer_device(codeBuffer, analogBuffer, len, deviceId);
+        r = wooting_analog_read_full_buffer_device(codeBuffer, analogBuffer, len, deviceId);
     }
     __except (WootingSdk_SehFilterOptional(L"wooting_analog_read_full_buffer_device", GetExceptionCode()))
     {
-        return (int)WootingAnalogResult_Failure;
+        r = (int)WootingAnalogResult_Failure;
+        seh = true;
     }
+    WootingCall_End(BackendWootingApi_ReadFullBufferDevice, t0, seh ? kWootingErrSeh : ((r < 0) ? r : 0));
+    return r;
 }
 
 #define wooting_analog_initialise WootingSafe_Initialise
@@ -298,6 +562,29 @@ static int WootingSafe_ReadFullBufferDevice(unsigned short* codeBuffer, float* a
 #define wooting_analog_read_full_buffer WootingSafe_ReadFullBuffer
 #define wooting_analog_read_full_buffer_device WootingSafe_ReadFullBufferDevice
 
+// Calls fn(index) for every set bit of `bits`, lowest first.
+template <typename Fn>
+static void ForEachSetBit(uint64_t bits, Fn&& fn)
+{
+    while (bits)
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long idx = 0;
+        _BitScanForward64(&idx, bits);
+#else
+        unsigned long idx = 0;
+        while (((bits >> idx) & 1ULL) == 0) ++idx;
+#endif
+        bits &= (bits - 1);
+        fn((int)idx);
+    }
+}
+
+static uint8_t PhysicalDownBit(uint16_t hid)
+{
+    return (uint8_t)((g_physicalDown[hid >> 6].load(std::memory_order_relaxed) >> (hid & 63)) & 1ULL);
+}
+
 // ---- native HID path (Aula implementation moved to isolated include) ----
 #include "backend_aula.inc"
 
@@ -396,100 +683,84 @@ static void LogConnectedDevicesDetailed(const wchar_t* stage)
     DebugLog_Write(L"[backend.devices] %s count=%d unique_ids=%d", stage ? stage : L"-", n, uniqueCount);
 }
 
-static uint16_t HidFallbackToVk(uint16_t hid)
-{
-    if (hid >= 4 && hid <= 29)  return (uint16_t)('A' + (hid - 4)); // A..Z
-    if (hid >= 30 && hid <= 38) return (uint16_t)('1' + (hid - 30)); // 1..9
-    if (hid == 39) return (uint16_t)'0';
-    switch (hid)
-    {
-    case 40: return VK_RETURN;
-    case 41: return VK_ESCAPE;
-    case 42: return VK_BACK;
-    case 43: return VK_TAB;
-    case 44: return VK_SPACE;
-    case 45: return VK_OEM_MINUS;
-    case 46: return VK_OEM_PLUS;
-    case 47: return VK_OEM_4;
-    case 48: return VK_OEM_6;
-    case 49: return VK_OEM_5;
-    case 51: return VK_OEM_1;
-    case 52: return VK_OEM_7;
-    case 54: return VK_OEM_COMMA;
-    case 55: return VK_OEM_PERIOD;
-    case 56: return VK_OEM_2;
-    case 57: return VK_CAPITAL;
-    case 58: return VK_F1;
-    case 59: return VK_F2;
-    case 60: return VK_F3;
-    case 61: return VK_F4;
-    case 62: return VK_F5;
-    case 63: return VK_F6;
-    case 64: return VK_F7;
-    case 65: return VK_F8;
-    case 66: return VK_F9;
-    case 67: return VK_F10;
-    case 68: return VK_F11;
-    case 69: return VK_F12;
-    case 73: return VK_INSERT;
-    case 74: return VK_HOME;
-    case 75: return VK_PRIOR;
-    case 76: return VK_DELETE;
-    case 77: return VK_END;
-    case 78: return VK_NEXT;
-    case 79: return VK_RIGHT;
-    case 80: return VK_LEFT;
-    case 81: return VK_DOWN;
-    case 82: return VK_UP;
-    case 83: return VK_NUMLOCK;
-    case 84: return VK_DIVIDE;
-    case 85: return VK_MULTIPLY;
-    case 86: return VK_SUBTRACT;
-    case 87: return VK_ADD;
-    case 89: return VK_NUMPAD1;
-    case 90: return VK_NUMPAD2;
-    case 91: return VK_NUMPAD3;
-    case 92: return VK_NUMPAD4;
-    case 93: return VK_NUMPAD5;
-    case 94: return VK_NUMPAD6;
-    case 95: return VK_NUMPAD7;
-    case 96: return VK_NUMPAD8;
-    case 97: return VK_NUMPAD9;
-    case 98: return VK_NUMPAD0;
-    case 99: return VK_DECIMAL;
-    case 224: return VK_LCONTROL;
-    case 225: return VK_LSHIFT;
-    case 226: return VK_LMENU;
-    case 227: return VK_LWIN;
-    case 228: return VK_RCONTROL;
-    case 229: return VK_RSHIFT;
-    case 230: return VK_RMENU;
-    case 231: return VK_RWIN;
-    default: return 0;
-    }
-}
-
-static uint16_t HidToModeCode(uint16_t hid, WootingAnalog_KeycodeType mode)
+// Code of a HID in one SDK keycode mode. ScanCode1 takes the table code first
+// (0xE0xx for extended keys, which the raw hook scan code cannot tell apart);
+// VK modes take the learned hook VK first, since it follows the active layout.
+static uint16_t ComputeModeCode(uint16_t hid, WootingAnalog_KeycodeType mode)
 {
     if (hid == 0) return 0;
     if (mode == WootingAnalog_KeycodeType_HID)
         return hid;
+    if (hid >= 256)
+        return 0;
 
-    if (hid < 256)
+    const uint16_t tableCode = KeycodeTables::HidToModeCode(hid, mode);
+    if (mode == WootingAnalog_KeycodeType_ScanCode1)
+        return tableCode ? tableCode : g_hidToScan[hid].load(std::memory_order_relaxed);
+    if (mode == WootingAnalog_KeycodeType_VirtualKey || mode == WootingAnalog_KeycodeType_VirtualKeyTranslate)
     {
-        if (mode == WootingAnalog_KeycodeType_ScanCode1)
-        {
-            uint16_t sc = g_hidToScan[hid].load(std::memory_order_relaxed);
-            return sc;
-        }
-        if (mode == WootingAnalog_KeycodeType_VirtualKey || mode == WootingAnalog_KeycodeType_VirtualKeyTranslate)
-        {
-            uint16_t vk = g_hidToVk[hid].load(std::memory_order_relaxed);
-            if (vk != 0) return vk;
-            return HidFallbackToVk(hid);
-        }
+        uint16_t vk = g_hidToVk[hid].load(std::memory_order_relaxed);
+        return vk ? vk : tableCode;
     }
-    return 0;
+    return tableCode;
+}
+
+// Mode codes for all 256 HIDs, rebuilt on the realtime thread only when the
+// keycode mode changes or the hook learns a new scan code / VK. The reverse
+// table starts as KeycodeTables' and is patched for learned codes.
+static std::array<uint16_t, 256> g_modeCodes{};
+static std::array<uint8_t, 512>  g_modeCodeHids{}; // by KeycodeTables::ModeCodeIndex
+static int                       g_modeCodesMode = -1;
+static uint32_t                  g_modeCodesLearnSeq = 0;
+
+static void RefreshModeCodes()
+{
+    const int mode = g_keycodeMode.load(std::memory_order_relaxed);
+    const uint32_t learnSeq = g_hidLearnSeq.load(std::memory_order_acquire);
+    if (mode == g_modeCodesMode && learnSeq == g_modeCodesLearnSeq)
+        return;
+
+    const auto kmode = (WootingAnalog_KeycodeType)mode;
+    if (kmode == WootingAnalog_KeycodeType_ScanCode1)
+        g_modeCodeHids = KeycodeTables::kScan1CodeToHid;
+    else if (kmode == WootingAnalog_KeycodeType_VirtualKey || kmode == WootingAnalog_KeycodeType_VirtualKeyTranslate)
+        g_modeCodeHids = KeycodeTables::kVkCodeToHid;
+    else
+        g_modeCodeHids.fill(0);
+
+    for (int hid = 0; hid < 256; ++hid)
+    {
+        const uint16_t code = ComputeModeCode((uint16_t)hid, kmode);
+        g_modeCodes[(size_t)hid] = code;
+
+        const uint16_t tableCode = KeycodeTables::HidToModeCode((uint16_t)hid, kmode);
+        if (hid == 0 || code == tableCode)
+            continue;
+        // Learned code: move the reverse entry from the table code to it.
+        if (tableCode != 0 && g_modeCodeHids[KeycodeTables::ModeCodeIndex(tableCode)] == hid)
+            g_modeCodeHids[KeycodeTables::ModeCodeIndex(tableCode)] = 0;
+        if (code != 0 && KeycodeTables::ModeCodeIndex(code) != 0)
+            g_modeCodeHids[KeycodeTables::ModeCodeIndex(code)] = (uint8_t)hid;
+    }
+    g_modeCodesMode = mode;
+    g_modeCodesLearnSeq = learnSeq;
+}
+
+static uint16_t HidToModeCode(uint16_t hid, WootingAnalog_KeycodeType mode)
+{
+    if (hid < 256 && (int)mode == g_modeCodesMode)
+        return g_modeCodes[hid];
+    return ComputeModeCode(hid, mode);
+}
+
+// Reverse of HidToModeCode through the precomputed table; 0 when the code is
+// unknown or the table is not built for this mode yet.
+static uint16_t HidFromModeCode(uint16_t code, WootingAnalog_KeycodeType mode)
+{
+    if (code == 0 || (int)mode != g_modeCodesMode) return 0;
+    if (mode == WootingAnalog_KeycodeType_HID)
+        return (code < 256) ? code : 0;
+    return g_modeCodeHids[KeycodeTables::ModeCodeIndex(code)];
 }
 
 static float SafeReadAnalogByCode(uint16_t code)
@@ -774,9 +1045,56 @@ static void LogWootingStateSnapshot(const wchar_t* stage)
         g_keycodeMode.load(std::memory_order_relaxed));
 }
 
+static void LogWootingApiStats()
+{
+    for (int api = 0; api < BackendWootingApi_Count; ++api)
+    {
+        BackendWootingApiStats st{};
+        if (!Backend_GetWootingApiStats(api, &st) || st.calls == 0)
+            continue;
+
+        // Upper bound of the bucket holding the 99th percentile call.
+        uint64_t want = (st.calls * 99 + 99) / 100;
+        uint64_t acc = 0;
+        int p99Bucket = kBackendWootingLatencyBuckets - 1;
+        for (int b = 0; b < kBackendWootingLatencyBuckets; ++b)
+        {
+            acc += st.latency[b];
+            if (acc >= want) { p99Bucket = b; break; }
+        }
+
+        // Non-zero error codes as "code:count" (WootingAnalogResult value, or "seh").
+        wchar_t codes[256]{};
+        for (int e = 0; e < kBackendWootingErrorSlots; ++e)
+        {
+            if (st.errorCodes[e] == 0) continue;
+            wchar_t t[40]{};
+            if (e == kBackendWootingErrorSlots - 1)
+                _snwprintf_s(t, _countof(t), _TRUNCATE, L"%sseh:%llu", codes[0] ? L"," : L"",
+                    (unsigned long long)st.errorCodes[e]);
+            else
+                _snwprintf_s(t, _countof(t), _TRUNCATE, L"%s%d:%llu", codes[0] ? L"," : L"",
+                    (int)WootingAnalogResult_UnInitialized + e, (unsigned long long)st.errorCodes[e]);
+            wcsncat_s(codes, _countof(codes), t, _TRUNCATE);
+        }
+
+        DebugLog_Write(
+            L"[backend.wooting.api] %s calls=%llu tick_last=%u tick_max=%u avg_us=%.2f p99_us<%u worst_us=%.1f errors=%llu codes=%s",
+            Backend_GetWootingApiName(api),
+            (unsigned long long)st.calls,
+            st.lastTickCalls,
+            st.maxTickCalls,
+            st.totalUs / (double)st.calls,
+            1u << p99Bucket,
+            st.worstUs,
+            (unsigned long long)st.errors,
+            codes[0] ? codes : L"-");
+    }
+}
+
 static float Clamp01(float v) { return std::clamp(v, 0.0f, 1.0f); }
 
-static void Vigem_Destroy()
+static void Vigem_DestroyUnlocked()
 {
     if (g_client)
     {
@@ -793,7 +1111,10 @@ static void Vigem_Destroy()
 
     g_connectedPadCount = 0;
     for (int i = 0; i < kMaxVirtualPads; ++i)
-        g_lastSentValid[(size_t)i] = 0;
+    {
+        g_padState[(size_t)i].lastSentValid = 0;
+        g_padState[(size_t)i].pacedPending = 0;
+    }
 
     if (g_client)
     {
@@ -803,7 +1124,16 @@ static void Vigem_Destroy()
     }
 }
 
-static bool Vigem_Create(int padCount, VIGEM_ERROR* outErr)
+static void Vigem_Destroy()
+{
+    ProgressCall_Enter(BackendCall_VigemConnect);
+    AcquireSRWLockExclusive(&g_vigemLifecycleLock);
+    Vigem_DestroyUnlocked();
+    ReleaseSRWLockExclusive(&g_vigemLifecycleLock);
+    ProgressCall_Leave();
+}
+
+static bool Vigem_CreateUnlocked(int padCount, VIGEM_ERROR* outErr)
 {
     padCount = std::clamp(padCount, 1, kMaxVirtualPads);
     if (outErr) *outErr = VIGEM_ERROR_NONE;
@@ -819,7 +1149,7 @@ static bool Vigem_Create(int padCount, VIGEM_ERROR* outErr)
         if (!pad)
         {
             if (outErr) *outErr = VIGEM_ERROR_INVALID_TARGET;
-            Vigem_Destroy();
+            Vigem_DestroyUnlocked();
             return false;
         }
 
@@ -828,7 +1158,7 @@ static bool Vigem_Create(int padCount, VIGEM_ERROR* outErr)
         {
             if (outErr) *outErr = err;
             vigem_target_free(pad);
-            Vigem_Destroy();
+            Vigem_DestroyUnlocked();
             return false;
         }
 
@@ -840,6 +1170,16 @@ static bool Vigem_Create(int padCount, VIGEM_ERROR* outErr)
     return true;
 }
 
+static bool Vigem_Create(int padCount, VIGEM_ERROR* outErr)
+{
+    ProgressCall_Enter(BackendCall_VigemConnect);
+    AcquireSRWLockExclusive(&g_vigemLifecycleLock);
+    bool ok = Vigem_CreateUnlocked(padCount, outErr);
+    ReleaseSRWLockExclusive(&g_vigemLifecycleLock);
+    ProgressCall_Leave();
+    return ok;
+}
+
 static bool Vigem_ReconnectThrottled(bool force = false)
 {
     ULONGLONG now = GetTickCount64();
@@ -876,9 +1216,30 @@ struct HidCache
     std::bitset<256> fullPresent{};
     std::bitset<256> hasRaw{};
     std::bitset<256> hasFiltered{};
+    std::bitset<256> hasUnchanged{};
+    std::bitset<256> unchanged{};
     bool hasFullBuffer = false;
+
+    // Button state of every HID bound to a button this tick (BackendDigital).
+    std::array<uint64_t, 4> buttonDown{};
+
+    // HID >= 256 (extended keycodes): small per-tick list, linear search.
+    static constexpr int kExtMax = 32;
+    int extCount = 0;
+    std::array<uint16_t, kExtMax> extHid{};
+    std::array<float, kExtMax> extRaw{};
+    std::array<float, kExtMax> extFiltered{};
+    std::array<uint8_t, kExtMax> extHasFiltered{};
 };
 
+// Returns the extended slot for hid, or -1 when the list is full.
+static int HidCache_FindExt(const HidCache& cache, uint16_t hid)
+{
+    for (int i = 0; i < cache.extCount; ++i)
+        if (cache.extHid[(size_t)i] == hid) return i;
+    return -1;
+}
+
 struct SimulatedKeyState
 {
     bool down = false;
@@ -894,13 +1255,86 @@ static bool IsHidDownViaAsyncState(uint16_t hidKeycode)
 
     uint16_t vk = g_hidToVk[hidKeycode].load(std::memory_order_relaxed);
     if (vk == 0)
-        vk = HidFallbackToVk(hidKeycode);
+        vk = KeycodeTables::HidToVk(hidKeycode);
     if (vk == 0)
         return false;
 
     return (GetAsyncKeyState((int)vk) & 0x8000) != 0;
 }
 
+static bool IsHidPhysicallyDown(uint16_t hidKeycode)
+{
+    if (hidKeycode == 0 || hidKeycode >= 256) return false;
+    if (!g_keyboardHookActive.load(std::memory_order_acquire))
+        return IsHidDownViaAsyncState(hidKeycode);
+    return PhysicalDownBit(hidKeycode) != 0;
+}
+
+static constexpr ULONGLONG kKeyboardHookSilentMs = 1000;
+
+// Windows drops a low-level hook that times out without telling it. A bound key
+// that reads down while its bit is clear and the hook has been silent for a
+// while means no event reached us: fall back to polling and have the UI thread
+// reinstall the hook.
+static bool DetectDroppedKeyboardHook(ULONGLONG nowMs)
+{
+    const ULONGLONG lastEventMs = g_lastKeyboardHookEventMs.load(std::memory_order_relaxed);
+    if (nowMs - lastEventMs < kKeyboardHookSilentMs)
+        return false;
+
+    uint16_t missedHid = 0;
+    for (int chunk = 0; chunk < 4 && missedHid == 0; ++chunk)
+    {
+        uint64_t bound = 0;
+        for (int pad = 0; pad < kMaxVirtualPads; ++pad)
+            bound |= Bindings_GetBoundMaskChunkForPad(pad, chunk);
+        if (chunk == 0) bound &= ~1ULL; // HID 0 = unbound
+        bound &= ~g_physicalDown[(size_t)chunk].load(std::memory_order_relaxed);
+        ForEachSetBit(bound, [&](int idx) {
+            const uint16_t hid = (uint16_t)(chunk * 64 + idx);
+            if (missedHid == 0 && IsHidDownViaAsyncState(hid))
+                missedHid = hid;
+        });
+    }
+    if (missedHid == 0)
+        return false;
+
+    g_keyboardHookActive.store(false, std::memory_order_release);
+    g_physicalVerifySuspect = {};
+    g_keyboardHookLost.store(true, std::memory_order_release);
+    DebugLog_Write(L"[backend.hook] keyboard hook silent for %llu ms while hid=%u is down; polling until reinstalled",
+        (unsigned long long)(nowMs - lastEventMs), (unsigned)missedHid);
+    return true;
+}
+
+// Missed key-ups would leave keys stuck down in g_physicalDown. Every 250 ms,
+// re-check only the keys believed down; one that reads up on two checks in a row
+// is released (a single miss can be a hook event racing the async state update).
+// The same pass checks for a dropped hook.
+static void VerifyPhysicalDownThrottled(ULONGLONG nowMs)
+{
+    if (!g_keyboardHookActive.load(std::memory_order_acquire)) return;
+    if (nowMs - g_physicalVerifyMs < 250) return;
+    g_physicalVerifyMs = nowMs;
+
+    if (DetectDroppedKeyboardHook(nowMs))
+        return;
+
+    for (int chunk = 0; chunk < 4; ++chunk)
+    {
+        uint64_t suspect = 0;
+        ForEachSetBit(g_physicalDown[(size_t)chunk].load(std::memory_order_relaxed), [&](int idx) {
+            const uint64_t bit = 1ULL << idx;
+            if (IsHidDownViaAsyncState((uint16_t)(chunk * 64 + idx))) return;
+            if (g_physicalVerifySuspect[(size_t)chunk] & bit)
+                g_physicalDown[(size_t)chunk].fetch_and(~bit, std::memory_order_relaxed);
+            else
+                suspect |= bit;
+        });
+        g_physicalVerifySuspect[(size_t)chunk] = suspect;
+    }
+}
+
 static float ReadDigitalFallback01(uint16_t hidKeycode)
 {
     if (hidKeycode == 0 || hidKeycode >= 256)
@@ -918,7 +1352,7 @@ static float ReadDigitalFallback01(uint16_t hidKeycode)
     }
     s.lastUpdateMs = now;
 
-    const bool down = IsHidDownViaAsyncState(hidKeycode);
+    const bool down = IsHidPhysicallyDown(hidKeycode);
     s.down = down;
 
     // Two-stage press curve:
@@ -966,14 +1400,28 @@ static float ReadMouseBindRaw01(uint16_t hidKeycode)
     }
 }
 
+static float ReadSimRaw01Cached(uint16_t hidKeycode, HidCache& cache)
+{
+    if (hidKeycode >= 256) return 0.0f;
+    if (cache.hasRaw.test(hidKeycode))
+        return cache.raw[hidKeycode];
+
+    float v = Clamp01((float)g_simRawM[hidKeycode].load(std::memory_order_relaxed) / 1000.0f);
+    cache.raw[hidKeycode] = v;
+    cache.hasRaw.set(hidKeycode);
+    return v;
+}
+
 static float ReadRaw01Cached(uint16_t hidKeycode, HidCache& cache)
 {
     if (hidKeycode == 0) return 0.0f;
     if (MouseBind_IsPseudoHid(hidKeycode))
         return ReadMouseBindRaw01(hidKeycode);
+    if (g_headless.load(std::memory_order_relaxed))
+        return ReadSimRaw01Cached(hidKeycode, cache);
 
     const bool aulaConnected = g_aulaConnected.load(std::memory_order_acquire);
-    const bool allowFallback = Settings_GetDigitalFallbackInput() && !aulaConnected;
+    const bool allowFallback = g_tickSettings.digitalFallbackInput && !aulaConnected;
     const bool wootingReady = g_wootingReady.load(std::memory_order_acquire);
     WootingAnalog_KeycodeType mode = (WootingAnalog_KeycodeType)g_keycodeMode.load(std::memory_order_relaxed);
     uint16_t modeCode = wootingReady ? HidToModeCode(hidKeycode, mode) : 0;
@@ -1058,8 +1506,19 @@ static float ReadRaw01Cached(uint16_t hidKeycode, HidCache& cache)
         return v;
     }
 
-    // HID>=256: no caching needed in this project (UI tracks <256 anyway).
+    // HID>=256: cached in the small extended list (one SDK read per tick per key).
     // Aula path reports only key ids in byte range [1..255], so HID>=256 stays SDK-only.
+    int extSlot = HidCache_FindExt(cache, hidKeycode);
+    if (extSlot >= 0)
+        return cache.extRaw[(size_t)extSlot];
+    if (cache.extCount < HidCache::kExtMax)
+    {
+        extSlot = cache.extCount++;
+        cache.extHid[(size_t)extSlot] = hidKeycode;
+        cache.extRaw[(size_t)extSlot] = 0.0f;
+        cache.extHasFiltered[(size_t)extSlot] = 0u;
+    }
+
     if (!wootingReady || modeCode == 0)
         return 0.0f;
 
@@ -1094,6 +1553,8 @@ static float ReadRaw01Cached(uint16_t hidKeycode, HidCache& cache)
                 g_digitalFallbackWarnPending.store(true, std::memory_order_release);
         }
     }
+    if (extSlot >= 0)
+        cache.extRaw[(size_t)extSlot] = v;
     return v;
 }
 
@@ -1108,16 +1569,160 @@ static float ReadFiltered01Cached(uint16_t hidKeycode, HidCache& cache)
         if (cache.hasFiltered.test(hidKeycode))
             return cache.filtered[hidKeycode];
 
-        float raw = ReadRaw01Cached(hidKeycode, cache);
+        // Smoothing and prediction sit before the curve so deadzones see the
+        // steadied / extrapolated travel.
+        float raw = BackendSmoothing_Apply(hidKeycode, ReadRaw01Cached(hidKeycode, cache));
+        raw = BackendPredict_Apply(hidKeycode, raw);
         float filtered = BackendCurve_ApplyByHid(hidKeycode, raw);
 
         cache.filtered[hidKeycode] = filtered;
         cache.hasFiltered.set(hidKeycode);
+        g_lastFiltered[hidKeycode] = filtered;
+        g_lastFilteredSerial[hidKeycode] = g_tickSerial;
         return filtered;
     }
 
     float raw = ReadRaw01Cached(hidKeycode, cache);
-    return BackendCurve_ApplyByHid(hidKeycode, raw);
+    int extSlot = HidCache_FindExt(cache, hidKeycode);
+    if (extSlot >= 0 && cache.extHasFiltered[(size_t)extSlot])
+        return cache.extFiltered[(size_t)extSlot];
+
+    float filtered = BackendCurve_ApplyByHid(hidKeycode, raw);
+    if (extSlot >= 0)
+    {
+        cache.extFiltered[(size_t)extSlot] = filtered;
+        cache.extHasFiltered[(size_t)extSlot] = 1u;
+    }
+    return filtered;
+}
+
+// Incremental tick: true when hid reads bit-identical to last tick and no smoothing
+// / prediction state would move its output. Call before the HID's first
+// ReadFiltered01Cached of the tick; updates the previous-value record once per tick.
+static bool HidUnchangedCached(uint16_t hid, HidCache& cache)
+{
+    if (hid == 0) return true;
+    if (hid >= 256) return false;
+    if (cache.hasUnchanged.test(hid))
+        return cache.unchanged.test(hid);
+
+    const float raw = ReadRaw01Cached(hid, cache);
+    const uint32_t bits = std::bit_cast<uint32_t>(raw);
+    const bool same =
+        g_prevRawSerial[hid] == g_tickSerial - 1u &&
+        g_prevRawBits[hid] == bits &&
+        BackendSmoothing_IsSettled(hid, raw) &&
+        BackendPredict_IsSettled(hid);
+    g_prevRawBits[hid] = bits;
+    g_prevRawSerial[hid] = g_tickSerial;
+
+    cache.hasUnchanged.set(hid);
+    if (same)
+    {
+        cache.unchanged.set(hid);
+        // The filter already sits on raw, so this counts as its sample for the tick;
+        // otherwise a key at rest goes stale and its first change passes unsmoothed.
+        BackendSmoothing_MarkSampled(hid);
+    }
+    return same;
+}
+
+// Bind capture: HIDs that can read above zero this tick, found with bulk reads
+// (SDK full buffers, the Aula frame, hook key-downs) instead of a per-key read
+// of all 255 HIDs. Returns false when the set cannot be trusted (read error,
+// full buffer, mode table stale); the caller then reads every HID. Some SDK /
+// plugin builds drop keys from full-buffer snapshots, so the caller also reads
+// every HID every kBindCaptureFullScanTicks ticks.
+static bool CollectBindCaptureCandidates(std::bitset<256>& out, uint16_t lastHid, const HidCache& cache)
+{
+    out.reset();
+    if (lastHid != 0 && lastHid < 256)
+        out.set(lastHid); // keep reading the held key even if a snapshot drops it
+    for (uint16_t hid = kMouseBindHidLButton; hid <= kMouseBindHidWheelDown; ++hid)
+        out.set(hid);
+
+    const bool aulaConnected = g_aulaConnected.load(std::memory_order_acquire);
+    if (aulaConnected)
+    {
+        for (uint16_t hid = 1; hid < 256; ++hid)
+        {
+            if (g_aulaAnalogMilli[hid].load(std::memory_order_relaxed) != 0)
+                out.set(hid);
+        }
+    }
+
+    // Hook key-downs cover analog keys that also type, and feed digital fallback.
+    const bool hookActive = g_keyboardHookActive.load(std::memory_order_acquire);
+    if (hookActive)
+    {
+        for (int chunk = 0; chunk < 4; ++chunk)
+        {
+            ForEachSetBit(g_physicalDown[(size_t)chunk].load(std::memory_order_relaxed), [&](int idx) {
+                out.set((size_t)(chunk * 64 + idx));
+            });
+        }
+    }
+
+    if (g_tickSettings.digitalFallbackInput && !aulaConnected)
+    {
+        for (uint16_t hid = 1; hid < 256; ++hid)
+        {
+            // Released fallback keys still ramp down for ~80 ms.
+            if (g_simulatedKeys[hid].value > 0.0f || (!hookActive && IsHidDownViaAsyncState(hid)))
+                out.set(hid);
+        }
+    }
+
+    if (!g_wootingReady.load(std::memory_order_acquire))
+        return true;
+
+    const WootingAnalog_KeycodeType mode = (WootingAnalog_KeycodeType)g_keycodeMode.load(std::memory_order_relaxed);
+    if ((int)mode != g_modeCodesMode)
+        return false;
+
+    // The tick already read the full buffers (HID mode assist): reuse them.
+    if (cache.hasFullBuffer)
+    {
+        for (uint16_t hid = 1; hid < 256; ++hid)
+        {
+            if (cache.fullPresent.test(hid) && cache.fullRaw[hid] > 0.0f)
+                out.set(hid);
+        }
+        return true;
+    }
+
+    auto addBuffer = [&](int ret, const unsigned short* codes, const float* vals, int cap) -> bool {
+        if (ret < 0 || ret >= cap)
+            return false;
+        for (int i = 0; i < ret; ++i)
+        {
+            if (!std::isfinite(vals[i]) || vals[i] <= 0.0f)
+                continue;
+            // A code no HID maps to is never read per key either.
+            uint16_t hid = HidFromModeCode(codes[i], mode);
+            if (hid != 0)
+                out.set(hid);
+        }
+        return true;
+    };
+
+    unsigned short codes[64]{};
+    float vals[64]{};
+    int ret = wooting_analog_read_full_buffer(codes, vals, (unsigned)_countof(codes));
+    if (!addBuffer(ret, codes, vals, (int)_countof(codes)))
+        return false;
+
+    // Same per-device pass as ReadAnalogByCodeWithDeviceFallback.
+    int n = std::clamp(g_knownDeviceCount.load(std::memory_order_relaxed), 0, (int)g_knownDeviceIds.size());
+    for (int i = 0; i < n; ++i)
+    {
+        unsigned short dcodes[64]{};
+        float dvals[64]{};
+        int dret = wooting_analog_read_full_buffer_device(dcodes, dvals, (unsigned)_countof(dcodes), g_knownDeviceIds[(size_t)i]);
+        if (!addBuffer(dret, dcodes, dvals, (int)_countof(dcodes)))
+            return false;
+    }
+    return true;
 }
 
 static SHORT StickFromMinus1Plus1(float x)
@@ -1138,14 +1743,6 @@ static bool Pressed(float v01)
     return v01 >= 0.10f;
 }
 
-// ---- Snappy Joystick (SOCD-like) state (backend thread) ----
-// One state per axis (LX,LY,RX,RY)
-static std::array<std::array<uint8_t, 4>, kMaxVirtualPads> g_snappyPrevMinusDown{};
-static std::array<std::array<uint8_t, 4>, kMaxVirtualPads> g_snappyPrevPlusDown{};
-static std::array<std::array<int8_t, 4>, kMaxVirtualPads>  g_snappyLastDir{}; // -1 = minus, +1 = plus, 0 = unknown
-static std::array<std::array<float, 4>, kMaxVirtualPads>   g_snappyMinusValley{};
-static std::array<std::array<float, 4>, kMaxVirtualPads>   g_snappyPlusValley{};
-
 static int AxisIndexSafe(Axis a)
 {
     switch (a)
@@ -1160,8 +1757,8 @@ static int AxisIndexSafe(Axis a)
 
 static float AxisValue_WithConflictModes(int padIndex, Axis a, float minusV, float plusV)
 {
-    const bool snapStick = Settings_GetSnappyJoystick();
-    const bool lastKeyPriority = Settings_GetLastKeyPriority();
+    const bool snapStick = g_tickSettings.snappyJoystick;
+    const bool lastKeyPriority = g_tickSettings.lastKeyPriority;
     if (!snapStick && !lastKeyPriority)
         return plusV - minusV;
 
@@ -1174,59 +1771,59 @@ static float AxisValue_WithConflictModes(int padIndex, Axis a, float minusV, flo
     bool plusDown = Pressed(plusV);
 
     int p = std::clamp(padIndex, 0, kMaxVirtualPads - 1);
-    bool prevMinus = (g_snappyPrevMinusDown[(size_t)p][idx] != 0);
-    bool prevPlus = (g_snappyPrevPlusDown[(size_t)p][idx] != 0);
+    bool prevMinus = (g_padState[(size_t)p].snappyPrevMinusDown[idx] != 0);
+    bool prevPlus = (g_padState[(size_t)p].snappyPrevPlusDown[idx] != 0);
 
-    if (minusDown && !prevMinus) g_snappyLastDir[(size_t)p][idx] = -1;
-    if (plusDown && !prevPlus)  g_snappyLastDir[(size_t)p][idx] = +1;
+    if (minusDown && !prevMinus) g_padState[(size_t)p].snappyLastDir[idx] = -1;
+    if (plusDown && !prevPlus)  g_padState[(size_t)p].snappyLastDir[idx] = +1;
 
     if (lastKeyPriority)
     {
         // Re-trigger threshold for analog "re-press" while key is still logically down.
         // Example: user slightly releases key and presses again without crossing Pressed() threshold.
-        const float repDelta = std::clamp(Settings_GetLastKeyPrioritySensitivity(), 0.02f, 0.95f);
+        const float repDelta = std::clamp(g_tickSettings.lastKeyPrioritySensitivity, 0.02f, 0.95f);
 
         if (!minusDown)
         {
-            g_snappyMinusValley[(size_t)p][idx] = 1.0f;
+            g_padState[(size_t)p].snappyMinusValley[idx] = 1.0f;
         }
         else if (!prevMinus)
         {
-            g_snappyMinusValley[(size_t)p][idx] = minusV;
+            g_padState[(size_t)p].snappyMinusValley[idx] = minusV;
         }
         else
         {
-            float& valley = g_snappyMinusValley[(size_t)p][idx];
+            float& valley = g_padState[(size_t)p].snappyMinusValley[idx];
             valley = std::min(valley, minusV);
             if ((minusV - valley) >= repDelta)
             {
-                g_snappyLastDir[(size_t)p][idx] = -1;
+                g_padState[(size_t)p].snappyLastDir[idx] = -1;
                 valley = minusV;
             }
         }
 
         if (!plusDown)
         {
-            g_snappyPlusValley[(size_t)p][idx] = 1.0f;
+            g_padState[(size_t)p].snappyPlusValley[idx] = 1.0f;
         }
         else if (!prevPlus)
         {
-            g_snappyPlusValley[(size_t)p][idx] = plusV;
+            g_padState[(size_t)p].snappyPlusValley[idx] = plusV;
         }
         else
         {
-            float& valley = g_snappyPlusValley[(size_t)p][idx];
+            float& valley = g_padState[(size_t)p].snappyPlusValley[idx];
             valley = std::min(valley, plusV);
             if ((plusV - valley) >= repDelta)
             {
-                g_snappyLastDir[(size_t)p][idx] = +1;
+                g_padState[(size_t)p].snappyLastDir[idx] = +1;
                 valley = plusV;
             }
         }
     }
 
-    g_snappyPrevMinusDown[(size_t)p][idx] = minusDown ? 1u : 0u;
-    g_snappyPrevPlusDown[(size_t)p][idx] = plusDown ? 1u : 0u;
+    g_padState[(size_t)p].snappyPrevMinusDown[idx] = minusDown ? 1u : 0u;
+    g_padState[(size_t)p].snappyPrevPlusDown[idx] = plusDown ? 1u : 0u;
 
     float maxV = std::max(minusV, plusV);
     if (maxV <= 0.0001f)
@@ -1244,7 +1841,7 @@ static float AxisValue_WithConflictModes(int padIndex, Axis a, float minusV, flo
     // Last Key Priority: when both directions are down, most recent press wins.
     if (lastKeyPriority && minusDown && plusDown)
     {
-        int8_t dir = g_snappyLastDir[(size_t)p][idx];
+        int8_t dir = g_padState[(size_t)p].snappyLastDir[idx];
         if (dir == 0)
             dir = (plusV >= minusV) ? +1 : -1;
 
@@ -1270,8 +1867,8 @@ static float AxisValue_WithConflictModes(int padIndex, Axis a, float minusV, flo
         if (std::fabs(d) > EQ_EPS)
             return (d > 0.0f) ? +maxV : -maxV;
 
-        if (g_snappyLastDir[(size_t)p][idx] > 0) return +maxV;
-        if (g_snappyLastDir[(size_t)p][idx] < 0) return -maxV;
+        if (g_padState[(size_t)p].snappyLastDir[idx] > 0) return +maxV;
+        if (g_padState[(size_t)p].snappyLastDir[idx] < 0) return -maxV;
         return 0.0f;
     }
 
@@ -1355,7 +1952,7 @@ static bool ReadMouseStickSample(float& outX, float& outY)
     outX = 0.0f;
     outY = 0.0f;
 
-    if (!Settings_GetMouseToStickEnabled())
+    if (!g_tickSettings.mouseToStickEnabled)
     {
         g_mouseHasLastPos = false;
         g_mouseSawRawInput.store(false, std::memory_order_relaxed);
@@ -1417,10 +2014,10 @@ static bool ReadMouseStickSample(float& outX, float& outY)
         }
     }
 
-    const float sens = std::clamp(Settings_GetMouseToStickSensitivity(), 0.1f, 8.0f);
-    const float aggressiveness = std::clamp(Settings_GetMouseToStickAggressiveness(), 0.2f, 3.0f);
-    const float maxOffsetMul = std::clamp(Settings_GetMouseToStickMaxOffset(), 0.0f, 6.0f);
-    const float followSpeedMul = std::clamp(Settings_GetMouseToStickFollowSpeed(), 0.2f, 3.0f);
+    const float sens = std::clamp(g_tickSettings.mouseToStickSensitivity, 0.1f, 8.0f);
+    const float aggressiveness = std::clamp(g_tickSettings.mouseToStickAggressiveness, 0.2f, 3.0f);
+    const float maxOffsetMul = std::clamp(g_tickSettings.mouseToStickMaxOffset, 0.0f, 6.0f);
+    const float followSpeedMul = std::clamp(g_tickSettings.mouseToStickFollowSpeed, 0.2f, 3.0f);
 
     // Base mouse-space unit: how many raw counts are needed for "1.0" of virtual range.
     const float baseRange = std::clamp(92.0f / sens, 10.0f, 260.0f);
@@ -1551,43 +2148,108 @@ static SHORT MergeStickAxis(SHORT baseAxis, float mouseAxis01)
     return (std::abs((int)mouse) >= std::abs((int)baseAxis)) ? mouse : baseAxis;
 }
 
+static constexpr int kGameButtonCount = (int)GameButton::DpadRight + 1;
+
+// Gathers every HID bound to a button on the pads being rebuilt (rebuildMask bit
+// per pad) and evaluates them in one BackendDigital pass, so per-key state
+// advances at most once per tick.
+static void UpdateButtonStates(int logicalPads, uint8_t rebuildMask, HidCache& cache)
+{
+    std::array<uint64_t, 4> bound{};
+    for (int pad = 0; pad < logicalPads; ++pad)
+    {
+        if ((rebuildMask & (1u << pad)) == 0) continue;
+        for (int b = 0; b < kGameButtonCount; ++b)
+            for (int chunk = 0; chunk < 4; ++chunk)
+                bound[(size_t)chunk] |= Bindings_GetButtonMaskChunkForPad(pad, (GameButton)b, chunk);
+    }
+    bound[0] &= ~1ULL; // HID 0 = unbound
+
+    std::array<uint16_t, 256> hids;
+    std::array<float, 256> values;
+    std::array<uint8_t, 256> down;
+    int count = 0;
+    for (int chunk = 0; chunk < 4; ++chunk)
+    {
+        ForEachSetBit(bound[(size_t)chunk], [&](int idx) {
+            uint16_t hid = (uint16_t)(chunk * 64 + idx);
+            hids[(size_t)count] = hid;
+            values[(size_t)count] = BackendDigital_UsesRaw(hid)
+                ? ReadRaw01Cached(hid, cache)
+                : ReadFiltered01Cached(hid, cache);
+            ++count;
+        });
+    }
+
+    BackendDigital_Evaluate(hids.data(), values.data(), count, down.data());
+
+    cache.buttonDown = {};
+    for (int i = 0; i < count; ++i)
+    {
+        if (!down[(size_t)i]) continue;
+        uint16_t hid = hids[(size_t)i];
+        cache.buttonDown[(size_t)(hid >> 6)] |= (1ULL << (hid & 63));
+    }
+}
+
 static bool BtnPressedFromMask(int padIndex, GameButton b, HidCache& cache)
 {
     for (int chunk = 0; chunk < 4; ++chunk)
     {
-        uint64_t bits = Bindings_GetButtonMaskChunkForPad(padIndex, b, chunk);
-        if (!bits) continue;
-#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
-        while (bits) {
-            unsigned long idx = 0;
-            _BitScanForward64(&idx, bits);
-            bits &= (bits - 1);
-            uint16_t hid = (uint16_t)(chunk * 64 + (int)idx);
-            float v01 = ReadFiltered01Cached(hid, cache);
-            if (Pressed(v01)) return true;
-        }
-#else
-        for (int bit = 0; bit < 64; ++bit) {
-            if (bits & (1ULL << bit)) {
-                uint16_t hid = (uint16_t)(chunk * 64 + bit);
-                float v01 = ReadFiltered01Cached(hid, cache);
-                if (Pressed(v01)) return true;
-            }
-        }
-#endif
+        if (Bindings_GetButtonMaskChunkForPad(padIndex, b, chunk) & cache.buttonDown[(size_t)chunk])
+            return true;
     }
     return false;
 }
 
-static XUSB_REPORT BuildReportForPad(int padIndex, HidCache& cache)
+static void RefreshPadInputs()
 {
-    XUSB_REPORT report{};
-    report.wButtons = 0;
+    for (int pad = 0; pad < kMaxVirtualPads; ++pad)
+    {
+        PadInputs& in = g_padInputs[(size_t)pad];
+        for (int chunk = 0; chunk < 4; ++chunk)
+            in.bound[(size_t)chunk] = Bindings_GetBoundMaskChunkForPad(pad, chunk);
+        in.bound[0] &= ~1ULL;
 
-    auto applyAxis = [&](Axis a, SHORT& out) {
-        AxisBinding b = Bindings_GetAxisForPad(padIndex, a);
-        float minusV = ReadFiltered01Cached(b.minusHid, cache);
-        float plusV = ReadFiltered01Cached(b.plusHid, cache);
+        in.alwaysRebuild = false;
+        for (int a = 0; a < 4; ++a)
+        {
+            AxisBinding b = Bindings_GetAxisForPad(pad, (Axis)a);
+            if (b.minusHid >= 256 || b.plusHid >= 256) in.alwaysRebuild = true;
+        }
+        for (int t = 0; t < 2; ++t)
+        {
+            if (Bindings_GetTriggerForPad(pad, (Trigger)t) >= 256) in.alwaysRebuild = true;
+        }
+    }
+}
+
+// True when the pad's report must be rebuilt this tick. Checks every bound HID
+// (no early exit) so their previous-value records stay one tick old.
+static bool PadInputsChanged(int padIndex, HidCache& cache)
+{
+    const PadInputs& in = g_padInputs[(size_t)padIndex];
+    bool changed = in.alwaysRebuild ||
+        (padIndex == 0 && g_tickSettings.mouseToStickEnabled); // mouse deltas arrive between ticks
+    for (int chunk = 0; chunk < 4; ++chunk)
+    {
+        ForEachSetBit(in.bound[(size_t)chunk], [&](int idx) {
+            if (!HidUnchangedCached((uint16_t)(chunk * 64 + idx), cache))
+                changed = true;
+        });
+    }
+    return changed;
+}
+
+static XUSB_REPORT BuildReportForPad(int padIndex, HidCache& cache)
+{
+    XUSB_REPORT report{};
+    report.wButtons = 0;
+
+    auto applyAxis = [&](Axis a, SHORT& out) {
+        AxisBinding b = Bindings_GetAxisForPad(padIndex, a);
+        float minusV = ReadFiltered01Cached(b.minusHid, cache);
+        float plusV = ReadFiltered01Cached(b.plusHid, cache);
         out = StickFromMinus1Plus1(AxisValue_WithConflictModes(padIndex, a, minusV, plusV));
         };
 
@@ -1596,12 +2258,12 @@ static XUSB_REPORT BuildReportForPad(int padIndex, HidCache& cache)
     applyAxis(Axis::RX, report.sThumbRX);
     applyAxis(Axis::RY, report.sThumbRY);
 
-    if (padIndex == 0 && Settings_GetMouseToStickEnabled())
+    if (padIndex == 0 && g_tickSettings.mouseToStickEnabled)
     {
         float mx = 0.0f, my = 0.0f;
         if (ReadMouseStickSample(mx, my))
         {
-            if (Settings_GetMouseToStickTarget() == 0)
+            if (g_tickSettings.mouseToStickTarget == 0)
             {
                 report.sThumbLX = MergeStickAxis(report.sThumbLX, mx);
                 report.sThumbLY = MergeStickAxis(report.sThumbLY, my);
@@ -1636,23 +2298,355 @@ static XUSB_REPORT BuildReportForPad(int padIndex, HidCache& cache)
     return report;
 }
 
-static bool IsReportSignificantlyDifferent(const XUSB_REPORT& a, const XUSB_REPORT& b)
+static bool IsReportDifferent(const XUSB_REPORT& a, const XUSB_REPORT& b)
+{
+    return a.wButtons != b.wButtons ||
+        a.bLeftTrigger != b.bLeftTrigger || a.bRightTrigger != b.bRightTrigger ||
+        a.sThumbLX != b.sThumbLX || a.sThumbLY != b.sThumbLY ||
+        a.sThumbRX != b.sThumbRX || a.sThumbRY != b.sThumbRY;
+}
+
+// Buttons always count; sticks / triggers only from the pad's thresholds up.
+static bool IsReportSignificantlyDifferent(const XUSB_REPORT& a, const XUSB_REPORT& b,
+    const SettingsSnapshot::ReportPolicy& rp)
 {
     if (a.wButtons != b.wButtons) return true;
-    if (std::abs((int)a.bLeftTrigger - (int)b.bLeftTrigger) >= 2) return true;
-    if (std::abs((int)a.bRightTrigger - (int)b.bRightTrigger) >= 2) return true;
 
-    if (std::abs((int)a.sThumbLX - (int)b.sThumbLX) >= 256) return true;
-    if (std::abs((int)a.sThumbLY - (int)b.sThumbLY) >= 256) return true;
-    if (std::abs((int)a.sThumbRX - (int)b.sThumbRX) >= 256) return true;
-    if (std::abs((int)a.sThumbRY - (int)b.sThumbRY) >= 256) return true;
+    const int trig = (int)rp.triggerThreshold;
+    if (std::abs((int)a.bLeftTrigger - (int)b.bLeftTrigger) >= trig) return true;
+    if (std::abs((int)a.bRightTrigger - (int)b.bRightTrigger) >= trig) return true;
+
+    const int stick = (int)rp.stickThreshold;
+    if (std::abs((int)a.sThumbLX - (int)b.sThumbLX) >= stick) return true;
+    if (std::abs((int)a.sThumbLY - (int)b.sThumbLY) >= stick) return true;
+    if (std::abs((int)a.sThumbRX - (int)b.sThumbRX) >= stick) return true;
+    if (std::abs((int)a.sThumbRY - (int)b.sThumbRY) >= stick) return true;
 
     return false;
 }
 
+static uint32_t ReportChecksum(const XUSB_REPORT& r)
+{
+    uint32_t h = 2166136261u;
+    auto mix = [&](uint32_t v) { h = (h ^ v) * 16777619u; };
+    mix(r.wButtons);
+    mix(((uint32_t)r.bLeftTrigger << 8) | r.bRightTrigger);
+    mix((uint16_t)r.sThumbLX);
+    mix((uint16_t)r.sThumbLY);
+    mix((uint16_t)r.sThumbRX);
+    mix((uint16_t)r.sThumbRY);
+    return h;
+}
+
+static void PublishLastReport(int pad, const XUSB_REPORT& report)
+{
+    g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_acq_rel);
+    g_lastReport[(size_t)pad] = report;
+    g_lastReportSum[(size_t)pad] = ReportChecksum(report);
+    g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_release);
+}
+
+static constexpr double kMinSendIntervalUs = 4000.0;
+static constexpr double kKeepAliveUs = 250000.0;
+
+static int64_t QpcFromUs(double us)
+{
+    static const double s_qpcPerUs = []() {
+        LARGE_INTEGER f{};
+        QueryPerformanceFrequency(&f);
+        return (double)f.QuadPart / 1000000.0;
+    }();
+    return (int64_t)(us * s_qpcPerUs);
+}
+
+// Why a built report was or was not submitted (per-pad counters below).
+enum class SubmitDecision : uint8_t
+{
+    SendChanged,       // first report, or a change at/above the pad's thresholds
+    SendFlush,         // Adaptive: small change whose flush deadline passed
+    SendKeepAlive,     // unchanged / small change resent after kKeepAliveUs
+    HoldUnchanged,
+    HoldSmall,         // change below the thresholds, waiting for flush / keep-alive
+    HoldPaced,         // change within kMinSendIntervalUs of the last send (see pacing)
+};
+
+static bool IsSend(SubmitDecision d)
+{
+    return d == SubmitDecision::SendChanged || d == SubmitDecision::SendFlush || d == SubmitDecision::SendKeepAlive;
+}
+
+struct PadReportCounters
+{
+    std::atomic<uint64_t> sent{ 0 };
+    std::atomic<uint64_t> sentFlush{ 0 };
+    std::atomic<uint64_t> sentKeepAlive{ 0 };
+    std::atomic<uint64_t> heldUnchanged{ 0 };
+    std::atomic<uint64_t> heldSmall{ 0 };
+    std::atomic<uint64_t> heldPaced{ 0 };
+
+    std::atomic<uint64_t> pacedDeferred{ 0 }; // changes that became a pending paced report
+    std::atomic<uint64_t> pacedByTimer{ 0 };  // pending report sent by the pacing flush
+    std::atomic<uint64_t> pacedByTick{ 0 };   // pending report sent by a regular tick
+    std::atomic<uint64_t> pacedDropped{ 0 };  // pending change reverted before it was due
+    std::atomic<uint64_t> pacedLateUsTotal{ 0 };
+    std::atomic<uint64_t> pacedLateUsMax{ 0 };
+};
+static std::array<PadReportCounters, kMaxVirtualPads> g_padReportCounters{};
+
+// What the pad sends next: the built report, unless a paced report still carries
+// a button edge the built one would undo (a tap shorter than the send interval).
+static const XUSB_REPORT& NextReportToSend(const PadState& ps)
+{
+    if (ps.pacedPending &&
+        ps.pacedReport.wButtons != ps.lastSent.wButtons &&
+        ps.report.wButtons == ps.lastSent.wButtons)
+        return ps.pacedReport;
+    return ps.report;
+}
+
+// Change detection + pacing, shared by the ViGEm path and headless mode.
+static SubmitDecision DecideReportSubmit(int idx, int64_t nowQpc)
+{
+    const PadState& ps = g_padState[(size_t)idx];
+    if (ps.lastSentValid == 0)
+        return SubmitDecision::SendChanged;
+
+    const SettingsSnapshot::ReportPolicy& rp = g_tickSettings.reportPolicy[(size_t)idx];
+    const XUSB_REPORT& next = NextReportToSend(ps);
+    const double elapsedUs = QpcToUs(nowQpc - ps.lastSentQpc);
+    const bool different = IsReportDifferent(next, ps.lastSent);
+
+    bool significant = different;
+    if (different && rp.policy != SettingsReportPolicy_Exact)
+        significant = IsReportSignificantlyDifferent(next, ps.lastSent, rp);
+
+    if (significant)
+        return (elapsedUs < kMinSendIntervalUs) ? SubmitDecision::HoldPaced : SubmitDecision::SendChanged;
+    // Flush never beats the minimum send interval (FlushMs is clamped to >= 4 too).
+    if (different && rp.policy == SettingsReportPolicy_Adaptive &&
+        elapsedUs >= std::max((double)rp.flushMs * 1000.0, kMinSendIntervalUs))
+        return SubmitDecision::SendFlush;
+    if (elapsedUs >= kKeepAliveUs)
+        return SubmitDecision::SendKeepAlive;
+    return different ? SubmitDecision::HoldSmall : SubmitDecision::HoldUnchanged;
+}
+
+// Tick side of pacing: a paced change becomes (or updates) the pending report,
+// due exactly one send interval after the last send. A pending change that has
+// been reverted before it was due is dropped.
+static void UpdatePacing(int idx, SubmitDecision d)
+{
+    PadState& ps = g_padState[(size_t)idx];
+    PadReportCounters& c = g_padReportCounters[(size_t)idx];
+    if (d == SubmitDecision::HoldPaced)
+    {
+        if (!ps.pacedPending)
+        {
+            ps.pacedDueQpc = ps.lastSentQpc + QpcFromUs(kMinSendIntervalUs);
+            c.pacedDeferred.fetch_add(1, std::memory_order_relaxed);
+        }
+        ps.pacedReport = NextReportToSend(ps);
+        ps.pacedPending = 1;
+    }
+    else if (ps.pacedPending && !IsSend(d))
+    {
+        ps.pacedPending = 0;
+        c.pacedDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+static void CountReportDecision(int idx, SubmitDecision d)
+{
+    PadReportCounters& c = g_padReportCounters[(size_t)idx];
+    switch (d)
+    {
+    case SubmitDecision::SendChanged: break;
+    case SubmitDecision::SendFlush: c.sentFlush.fetch_add(1, std::memory_order_relaxed); break;
+    case SubmitDecision::SendKeepAlive: c.sentKeepAlive.fetch_add(1, std::memory_order_relaxed); break;
+    case SubmitDecision::HoldUnchanged: c.heldUnchanged.fetch_add(1, std::memory_order_relaxed); break;
+    case SubmitDecision::HoldSmall: c.heldSmall.fetch_add(1, std::memory_order_relaxed); break;
+    case SubmitDecision::HoldPaced: c.heldPaced.fetch_add(1, std::memory_order_relaxed); break;
+    }
+    if (!IsSend(d))
+        g_reportsSuppressed.fetch_add(1, std::memory_order_relaxed);
+}
+
+// One line per active pad every 10 s (realtime thread), so the submit rate of a
+// policy can be read from log.txt while playing.
+static ULONGLONG g_lastReportStatsLogMs = 0;
+
+static void LogReportStatsThrottled(ULONGLONG nowMs, int pads)
+{
+    if (nowMs - g_lastReportStatsLogMs < 10000) return;
+    g_lastReportStatsLogMs = nowMs;
+
+    for (int pad = 0; pad < pads; ++pad)
+    {
+        const PadReportCounters& c = g_padReportCounters[(size_t)pad];
+        const SettingsSnapshot::ReportPolicy& rp = g_tickSettings.reportPolicy[(size_t)pad];
+        DebugLog_Write(L"[backend.reports] pad=%d policy=%u stick=%u trig=%u flush_ms=%u "
+            L"sent=%llu flush=%llu keepalive=%llu held_small=%llu held_paced=%llu held_same=%llu "
+            L"paced=%llu paced_timer=%llu paced_tick=%llu paced_late_max_us=%llu",
+            pad + 1, (unsigned)rp.policy, (unsigned)rp.stickThreshold, (unsigned)rp.triggerThreshold,
+            (unsigned)rp.flushMs,
+            (unsigned long long)c.sent.load(std::memory_order_relaxed),
+            (unsigned long long)c.sentFlush.load(std::memory_order_relaxed),
+            (unsigned long long)c.sentKeepAlive.load(std::memory_order_relaxed),
+            (unsigned long long)c.heldSmall.load(std::memory_order_relaxed),
+            (unsigned long long)c.heldPaced.load(std::memory_order_relaxed),
+            (unsigned long long)c.heldUnchanged.load(std::memory_order_relaxed),
+            (unsigned long long)c.pacedDeferred.load(std::memory_order_relaxed),
+            (unsigned long long)c.pacedByTimer.load(std::memory_order_relaxed),
+            (unsigned long long)c.pacedByTick.load(std::memory_order_relaxed),
+            (unsigned long long)c.pacedLateUsMax.load(std::memory_order_relaxed));
+    }
+}
+
+static void MarkReportSent(int idx, const XUSB_REPORT& sent, int64_t nowQpc, bool byPacingFlush)
+{
+    PadState& ps = g_padState[(size_t)idx];
+    PadReportCounters& c = g_padReportCounters[(size_t)idx];
+    if (ps.pacedPending)
+    {
+        ps.pacedPending = 0;
+        (byPacingFlush ? c.pacedByTimer : c.pacedByTick).fetch_add(1, std::memory_order_relaxed);
+        const uint64_t lateUs = (uint64_t)std::max(0.0, QpcToUs(nowQpc - ps.pacedDueQpc));
+        c.pacedLateUsTotal.fetch_add(lateUs, std::memory_order_relaxed);
+        if (lateUs > c.pacedLateUsMax.load(std::memory_order_relaxed))
+            c.pacedLateUsMax.store(lateUs, std::memory_order_relaxed);
+    }
+
+    ps.lastSent = sent;
+    ps.lastSentQpc = nowQpc;
+    ps.lastSentValid = 1;
+    g_reportsSent.fetch_add(1, std::memory_order_relaxed);
+    c.sent.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Closes the running stage (if any) and starts the next one.
+struct TickStageClock
+{
+    int stage = -1;
+    int64_t startQpc = 0;
+};
+
+static void TickStage_Enter(TickStageClock& c, int nextStage)
+{
+    int64_t now = QpcNow();
+    if (c.stage >= 0 && c.stage < BackendTickStage_Count)
+    {
+        int64_t d = now - c.startQpc;
+        g_stageLastQpc[(size_t)c.stage].store(d, std::memory_order_relaxed);
+        g_stageTotalQpc[(size_t)c.stage].fetch_add(d, std::memory_order_relaxed);
+    }
+    c.stage = nextStage;
+    c.startQpc = now;
+    g_progressStageQpc.store(now, std::memory_order_relaxed);
+    g_progressStage.store(nextStage, std::memory_order_release);
+}
+
+// Flight recorder frame for the tick that just finished, plus anomaly triggers.
+static bool g_flightSdkFaultedPrev = false; // realtime thread only
+
+static void RecordFlightFrame(int64_t startQpc, int64_t endQpc, const HidCache& cache, int pads,
+    uint8_t sentMask, uint8_t suppressedMask, bool vigemFailed, bool headless)
+{
+    static_assert(kFlightStages == BackendTickStage_Count, "flight frame stage count");
+    static_assert(kFlightMaxPads >= kMaxVirtualPads, "flight frame pad count");
+
+    FlightFrame f{};
+    f.qpc = startQpc;
+    f.tickUs = (uint32_t)std::clamp(QpcToUs(endQpc - startQpc), 0.0, 4.0e9);
+    for (int st = 0; st < BackendTickStage_Count; ++st)
+    {
+        double us = QpcToUs(g_stageLastQpc[(size_t)st].load(std::memory_order_relaxed));
+        f.stageUs[st] = (uint16_t)std::clamp(us, 0.0, 65535.0);
+    }
+
+    f.padCount = (uint8_t)std::clamp(pads, 0, kMaxVirtualPads);
+    f.sentMask = sentMask;
+    f.suppressedMask = suppressedMask;
+    for (int p = 0; p < (int)f.padCount; ++p)
+    {
+        const XUSB_REPORT& r = g_padState[(size_t)p].report;
+        f.pads[p] = FlightPadReport{ r.wButtons, r.bLeftTrigger, r.bRightTrigger,
+            r.sThumbLX, r.sThumbLY, r.sThumbRX, r.sThumbRY };
+    }
+
+    // Only keys that were read this tick and are not at rest.
+    for (int hid = 1; hid < 256 && f.hidCount < kFlightMaxHids; ++hid)
+    {
+        if (!cache.hasRaw.test((size_t)hid)) continue;
+        float raw = cache.raw[(size_t)hid];
+        float filtered = cache.hasFiltered.test((size_t)hid) ? cache.filtered[(size_t)hid]
+            : (cache.unchanged.test((size_t)hid) ? g_lastFiltered[(size_t)hid] : 0.0f);
+        if (raw <= 0.0f && filtered <= 0.0f) continue;
+
+        FlightHidSample& h = f.hids[f.hidCount++];
+        h.hid = (uint16_t)hid;
+        h.rawM = (uint16_t)std::clamp((int)lroundf(raw * 1000.0f), 0, 1000);
+        h.filteredM = (uint16_t)std::clamp((int)lroundf(filtered * 1000.0f), 0, 1000);
+    }
+
+    uint32_t reasons = FlightDumpReason_None;
+    uint32_t budgetUs = FlightRecorder_GetBudgetUs();
+    if (budgetUs != 0 && f.tickUs > budgetUs)
+    {
+        f.flags |= FlightFrameFlag_OverBudget;
+        reasons |= FlightDumpReason_OverBudget;
+    }
+    if (vigemFailed)
+    {
+        f.flags |= FlightFrameFlag_VigemFail;
+        reasons |= FlightDumpReason_VigemFail;
+    }
+    bool sdkFaulted = g_wootingSdkFaulted.load(std::memory_order_acquire);
+    if (sdkFaulted)
+    {
+        f.flags |= FlightFrameFlag_SdkFaulted;
+        if (!g_flightSdkFaultedPrev)
+            reasons |= FlightDumpReason_SdkFault;
+    }
+    g_flightSdkFaultedPrev = sdkFaulted;
+    if (headless)
+        f.flags |= FlightFrameFlag_Headless;
+
+    FlightRecorder_Push(f);
+    if (reasons != FlightDumpReason_None)
+        FlightRecorder_RequestDump(reasons);
+}
+
+static void ResetMouseStickState()
+{
+    g_mouseHasLastPos = false;
+    g_mouseSawRawInput.store(false, std::memory_order_relaxed);
+    g_mouseFilteredX = 0.0f;
+    g_mouseFilteredY = 0.0f;
+    g_mouseTargetX = 0.0;
+    g_mouseTargetY = 0.0;
+    g_mouseFollowerX = 0.0;
+    g_mouseFollowerY = 0.0;
+    g_mouseLastTickMs = 0;
+    g_mouseRawAccumDx.store(0, std::memory_order_relaxed);
+    g_mouseRawAccumDy.store(0, std::memory_order_relaxed);
+    g_mouseDbgEnabled.store(0, std::memory_order_relaxed);
+    g_mouseDbgUsingRaw.store(0, std::memory_order_relaxed);
+    g_mouseDbgTargetX10.store(0, std::memory_order_relaxed);
+    g_mouseDbgTargetY10.store(0, std::memory_order_relaxed);
+    g_mouseDbgFollowerX10.store(0, std::memory_order_relaxed);
+    g_mouseDbgFollowerY10.store(0, std::memory_order_relaxed);
+    g_mouseDbgOutX1000.store(0, std::memory_order_relaxed);
+    g_mouseDbgOutY1000.store(0, std::memory_order_relaxed);
+    g_mouseDbgRadius1000.store(1000, std::memory_order_relaxed);
+    for (auto& b : g_mouseBindButtons) b.store(0, std::memory_order_relaxed);
+    g_mouseWheelPulseUpUntilMs.store(0, std::memory_order_relaxed);
+    g_mouseWheelPulseDownUntilMs.store(0, std::memory_order_relaxed);
+}
+
 bool Backend_Init()
 {
     DebugLog_Write(L"[backend.init] begin");
+    g_headless.store(false, std::memory_order_release);
     g_wootingSdkFaulted.store(false, std::memory_order_release);
     g_wootingOptionalFaultCount.store(0, std::memory_order_relaxed);
     g_wootingReady.store(false, std::memory_order_release);
@@ -1676,30 +2670,8 @@ bool Backend_Init()
     g_zeroProbeStreak.store(0, std::memory_order_relaxed);
     g_autoRecoverTried.store(false, std::memory_order_relaxed);
     g_keycodeModeLocked.store(false, std::memory_order_relaxed);
-    g_mouseHasLastPos = false;
-    g_mouseSawRawInput.store(false, std::memory_order_relaxed);
-    g_mouseFilteredX = 0.0f;
-    g_mouseFilteredY = 0.0f;
-    g_mouseTargetX = 0.0;
-    g_mouseTargetY = 0.0;
-    g_mouseFollowerX = 0.0;
-    g_mouseFollowerY = 0.0;
-    g_mouseLastTickMs = 0;
-    g_mouseRawAccumDx.store(0, std::memory_order_relaxed);
-    g_mouseRawAccumDy.store(0, std::memory_order_relaxed);
-    g_mouseDbgEnabled.store(0, std::memory_order_relaxed);
-    g_mouseDbgUsingRaw.store(0, std::memory_order_relaxed);
-    g_mouseDbgTargetX10.store(0, std::memory_order_relaxed);
-    g_mouseDbgTargetY10.store(0, std::memory_order_relaxed);
-    g_mouseDbgFollowerX10.store(0, std::memory_order_relaxed);
-    g_mouseDbgFollowerY10.store(0, std::memory_order_relaxed);
-    g_mouseDbgOutX1000.store(0, std::memory_order_relaxed);
-    g_mouseDbgOutY1000.store(0, std::memory_order_relaxed);
-    g_mouseDbgRadius1000.store(1000, std::memory_order_relaxed);
-    for (auto& b : g_mouseBindButtons) b.store(0, std::memory_order_relaxed);
+    ResetMouseStickState();
     for (auto& s : g_physicalDown) s.store(0, std::memory_order_relaxed);
-    g_mouseWheelPulseUpUntilMs.store(0, std::memory_order_relaxed);
-    g_mouseWheelPulseDownUntilMs.store(0, std::memory_order_relaxed);
 
     uint32_t initIssues = BackendInitIssue_None;
     int wootingInit = wooting_analog_initialise();
@@ -1798,10 +2770,13 @@ bool Backend_Init()
     for (auto& d : g_uiDirty)   d.store(0, std::memory_order_relaxed);
     for (int i = 0; i < kMaxVirtualPads; ++i)
     {
-        g_lastSentValid[(size_t)i] = 0;
-        g_lastSentTicks[(size_t)i] = 0;
-        g_lastSentReports[(size_t)i] = XUSB_REPORT{};
+        g_padState[(size_t)i].lastSentValid = 0;
+        g_padState[(size_t)i].lastSentQpc = 0;
+        g_padState[(size_t)i].lastSent = XUSB_REPORT{};
+        g_padState[(size_t)i].pacedPending = 0;
     }
+    g_builtPadCount = kMaxVirtualPads;
+    g_incremental.valid = false;
 
     DebugLog_Write(L"[backend.init] success");
     return true;
@@ -1812,30 +2787,8 @@ void Backend_Shutdown()
     DebugLog_Write(L"[backend] shutdown");
     g_wootingReady.store(false, std::memory_order_release);
     g_knownDeviceCount.store(0, std::memory_order_relaxed);
-    g_mouseHasLastPos = false;
-    g_mouseSawRawInput.store(false, std::memory_order_relaxed);
-    g_mouseFilteredX = 0.0f;
-    g_mouseFilteredY = 0.0f;
-    g_mouseTargetX = 0.0;
-    g_mouseTargetY = 0.0;
-    g_mouseFollowerX = 0.0;
-    g_mouseFollowerY = 0.0;
-    g_mouseLastTickMs = 0;
-    g_mouseRawAccumDx.store(0, std::memory_order_relaxed);
-    g_mouseRawAccumDy.store(0, std::memory_order_relaxed);
-    g_mouseDbgEnabled.store(0, std::memory_order_relaxed);
-    g_mouseDbgUsingRaw.store(0, std::memory_order_relaxed);
-    g_mouseDbgTargetX10.store(0, std::memory_order_relaxed);
-    g_mouseDbgTargetY10.store(0, std::memory_order_relaxed);
-    g_mouseDbgFollowerX10.store(0, std::memory_order_relaxed);
-    g_mouseDbgFollowerY10.store(0, std::memory_order_relaxed);
-    g_mouseDbgOutX1000.store(0, std::memory_order_relaxed);
-    g_mouseDbgOutY1000.store(0, std::memory_order_relaxed);
-    g_mouseDbgRadius1000.store(1000, std::memory_order_relaxed);
-    for (auto& b : g_mouseBindButtons) b.store(0, std::memory_order_relaxed);
+    ResetMouseStickState();
     for (auto& s : g_physicalDown) s.store(0, std::memory_order_relaxed);
-    g_mouseWheelPulseUpUntilMs.store(0, std::memory_order_relaxed);
-    g_mouseWheelPulseDownUntilMs.store(0, std::memory_order_relaxed);
     g_reconnectRequested.store(false, std::memory_order_release);
     g_deviceChangeReconnectRequested.store(false, std::memory_order_release);
     g_keycodeModeLocked.store(false, std::memory_order_relaxed);
@@ -1843,23 +2796,105 @@ void Backend_Shutdown()
     AulaStop();
     Aula_ResetKeyState();
     Vigem_Destroy();
-    wooting_analog_uninitialise();
+    if (!g_headless.exchange(false, std::memory_order_acq_rel))
+        wooting_analog_uninitialise();
+}
+
+bool Backend_InitHeadless(int padCount)
+{
+    padCount = std::clamp(padCount, 1, kMaxVirtualPads);
+    DebugLog_Write(L"[backend.init] headless pads=%d", padCount);
+    g_headless.store(true, std::memory_order_release);
+    g_wootingReady.store(false, std::memory_order_release);
+    g_knownDeviceCount.store(0, std::memory_order_relaxed);
+    g_virtualPadCount.store(padCount, std::memory_order_release);
+    g_virtualPadsEnabled.store(true, std::memory_order_release);
+    g_lastInitIssues.store(BackendInitIssue_None, std::memory_order_release);
+    g_reconnectRequested.store(false, std::memory_order_release);
+    g_deviceChangeReconnectRequested.store(false, std::memory_order_release);
+    g_vigemUpdateFailStreak = 0;
+    g_vigemOk.store(true, std::memory_order_release);
+    g_vigemLastErr.store(VIGEM_ERROR_NONE, std::memory_order_release);
+
+    ResetMouseStickState();
+    // Deltas come only from Backend_AddMouseDelta; never sample the real cursor.
+    g_mouseSawRawInput.store(true, std::memory_order_relaxed);
+    for (auto& s : g_physicalDown) s.store(0, std::memory_order_relaxed);
+    BackendSim_ClearAll();
+
+    for (auto& a : g_uiAnalogM) a.store(0, std::memory_order_relaxed);
+    for (auto& a : g_uiRawM)    a.store(0, std::memory_order_relaxed);
+    for (auto& d : g_uiDirty)   d.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < kMaxVirtualPads; ++i)
+    {
+        g_padState[(size_t)i].lastSentValid = 0;
+        g_padState[(size_t)i].lastSentQpc = 0;
+        g_padState[(size_t)i].lastSent = XUSB_REPORT{};
+        g_padState[(size_t)i].pacedPending = 0;
+    }
+    g_builtPadCount = kMaxVirtualPads;
+    g_incremental.valid = false;
+    Backend_ResetTickProfile();
+    return true;
 }
 
 void Backend_Tick()
 {
+    TickStageClock stageClock;
+    TickStage_Enter(stageClock, BackendTickStage_Input);
+    const int64_t tickStartQpc = stageClock.startQpc;
+    const bool headless = g_headless.load(std::memory_order_relaxed);
+    uint8_t sentMask = 0;
+    uint8_t suppressedMask = 0;
+    bool vigemFailed = false;
+
     ULONGLONG nowMs = GetTickCount64();
-    BackendCurve_BeginTick();
+    const uint32_t configSeq = g_configSeq.load(std::memory_order_acquire);
+
+    // Versions are read before the data they guard: a publish in between shows
+    // up as a change next tick.
+    IncrementalState incr;
+    incr.valid = true;
+    incr.settingsVersion = Settings_GetSnapshotVersion();
+    incr.keyGeneration = KeySettings_GetGeneration();
+    incr.bindingsGeneration = Bindings_GetGeneration();
+    incr.configSeq = configSeq;
+    incr.headless = headless;
+    const bool fullRebuild = !g_incremental.valid ||
+        g_incremental.settingsVersion != incr.settingsVersion ||
+        g_incremental.keyGeneration != incr.keyGeneration ||
+        g_incremental.bindingsGeneration != incr.bindingsGeneration ||
+        g_incremental.configSeq != incr.configSeq ||
+        g_incremental.headless != incr.headless;
+    ++g_tickSerial;
+
+    Settings_GetSnapshot(&g_tickSettings);
+    RefreshModeCodes();
+    BackendCurve_BeginTick(g_tickSettings);
+    BackendDigital_BeginTick();
+    BackendSmoothing_BeginTick(g_tickSettings, tickStartQpc);
+    BackendPredict_BeginTick(g_tickSettings, tickStartQpc);
     ULONGLONG lastStateLog = g_lastWootingStateLogMs.load(std::memory_order_relaxed);
     if (g_wootingReady.load(std::memory_order_acquire) && nowMs - lastStateLog >= 10000)
     {
         g_lastWootingStateLogMs.store(nowMs, std::memory_order_relaxed);
         LogWootingStateSnapshot(L"tick_heartbeat");
+        LogWootingApiStats();
+    }
+    if (!headless)
+    {
+        AulaTickHotplug(nowMs);
+        AulaDecayStaleKeys(nowMs);
+        if (g_tickSettings.digitalFallbackInput)
+            VerifyPhysicalDownThrottled(nowMs);
     }
-    AulaTickHotplug(nowMs);
-    AulaDecayStaleKeys(nowMs);
 
-    if (g_reconnectRequested.exchange(false, std::memory_order_acq_rel))
+    if (headless)
+    {
+        g_reconnectRequested.store(false, std::memory_order_relaxed);
+        g_deviceChangeReconnectRequested.store(false, std::memory_order_relaxed);
+    }
+    else if (g_reconnectRequested.exchange(false, std::memory_order_acq_rel))
     {
         DebugLog_Write(L"[backend.tick] reconnect requested (force)");
         g_deviceChangeReconnectRequested.store(false, std::memory_order_release);
@@ -1880,7 +2915,7 @@ void Backend_Tick()
     if (kEnableFullBufferAssist && g_wootingReady.load(std::memory_order_acquire))
     {
         // Full-buffer reads can be expensive on some stacks; throttle to reduce global input lag.
-        UINT assistMinPeriodMs = std::max<UINT>(4u, Settings_GetPollingMs());
+        UINT assistMinPeriodMs = std::max<UINT>(4u, g_tickSettings.pollingMs);
         bool assistDue = (nowMs - s_lastFullAssistTickMs >= assistMinPeriodMs);
         if (assistDue)
         {
@@ -1933,6 +2968,7 @@ void Backend_Tick()
         }
     }
 
+    TickStage_Enter(stageClock, BackendTickStage_Tracked);
     int cnt = g_trackedCount.load(std::memory_order_acquire);
     cnt = std::clamp(cnt, 0, 256);
     uint16_t maxRawM = 0;
@@ -1946,9 +2982,11 @@ void Backend_Tick()
         uint16_t hid = g_trackedList[i];
         if (hid == 0 || hid >= 256) continue;
 
-        float raw = ReadRaw01Cached(hid, cache);
-        float filtered = ReadFiltered01Cached(hid, cache);
+        // Input unchanged since the curve last ran for it: same output, nothing to publish.
+        const bool reuseOut = HidUnchangedCached(hid, cache) && !fullRebuild &&
+            g_lastFilteredSerial[hid] == g_tickSerial - 1u;
 
+        float raw = ReadRaw01Cached(hid, cache);
         int rawM = (int)std::lround(raw * 1000.0f);
         rawM = std::clamp(rawM, 0, 1000);
         g_uiRawM[hid].store((uint16_t)rawM, std::memory_order_relaxed);
@@ -1958,6 +2996,12 @@ void Backend_Tick()
             maxRawHid = hid;
         }
 
+        float filtered = g_lastFiltered[hid];
+        if (reuseOut)
+            g_lastFilteredSerial[hid] = g_tickSerial;
+        else
+            filtered = ReadFiltered01Cached(hid, cache);
+
         int outM = (int)std::lround(filtered * 1000.0f);
         outM = std::clamp(outM, 0, 1000);
         if ((uint16_t)outM >= maxOutM)
@@ -1965,6 +3009,8 @@ void Backend_Tick()
             maxOutM = (uint16_t)outM;
             maxOutHid = hid;
         }
+        if (reuseOut)
+            continue; // UI snapshot already holds this value
 
         uint16_t newV = (uint16_t)outM;
         uint16_t oldV = g_uiAnalogM[hid].load(std::memory_order_relaxed);
@@ -2041,13 +3087,24 @@ void Backend_Tick()
         }
     }
 
-    // Bind capture: scan all HID 1..255 and capture first edge above threshold.
+    // Bind capture: capture the first edge of the strongest HID above threshold.
+    // Between periodic full scans, only HIDs that a bulk read reports as active
+    // are read per key; the rest read 0 and cannot win. A key a partial snapshot
+    // drops is still seen by the next full scan and then stays a candidate while
+    // it is the strongest. Ascending order keeps the lowest HID on ties.
+    TickStage_Enter(stageClock, BackendTickStage_BindCapture);
     if (g_bindCaptureEnabled.load(std::memory_order_acquire))
     {
+        const bool fullScanDue = (g_bindCaptureTicks++ % kBindCaptureFullScanTicks) == 0;
+        std::bitset<256> candidates;
+        const bool bulk = !headless && !fullScanDue &&
+            CollectBindCaptureCandidates(candidates, g_bindLastHid, cache);
         uint16_t bestHid = 0;
         int bestRawM = 0;
         for (uint16_t hid = 1; hid < 256; ++hid)
         {
+            if (bulk && !candidates.test(hid))
+                continue;
             float raw = ReadRaw01Cached(hid, cache);
             int rawM = (int)std::lround(raw * 1000.0f);
             if (rawM > bestRawM)
@@ -2065,42 +3122,111 @@ void Backend_Tick()
             g_bindCapturedPacked.store(packed, std::memory_order_release);
         }
         g_bindHadDown.store(down, std::memory_order_relaxed);
+        g_bindLastHid = bestHid;
     }
     else
     {
         g_bindHadDown.store(false, std::memory_order_relaxed);
+        g_bindLastHid = 0;
+        g_bindCaptureTicks = 0;
     }
 
+    TickStage_Enter(stageClock, BackendTickStage_Reports);
+    // The pads now show the watchdog's zero report, not lastSent: send the real
+    // state on this tick instead of waiting for the keep-alive.
+    if (g_padsNeutralized.exchange(false, std::memory_order_acq_rel))
+    {
+        for (int i = 0; i < kMaxVirtualPads; ++i)
+        {
+            g_padState[(size_t)i].lastSentValid = 0;
+            g_padState[(size_t)i].pacedPending = 0;
+        }
+    }
     int logicalPads = std::clamp(g_virtualPadCount.load(std::memory_order_acquire), 1, kMaxVirtualPads);
+    std::array<XUSB_REPORT, kMaxVirtualPads> built{};
+    if (fullRebuild)
+        RefreshPadInputs();
+    const bool padsReusable = !fullRebuild && logicalPads == g_builtPadCount;
+    uint8_t rebuildMask = 0;
+    for (int pad = 0; pad < logicalPads; ++pad)
+    {
+        if (PadInputsChanged(pad, cache) || !padsReusable)
+            rebuildMask |= (uint8_t)(1u << pad);
+    }
+    UpdateButtonStates(logicalPads, rebuildMask, cache);
     for (int pad = 0; pad < logicalPads; ++pad)
     {
-        XUSB_REPORT report = BuildReportForPad(pad, cache);
-        g_reports[(size_t)pad] = report;
+        built[(size_t)pad] = (rebuildMask & (1u << pad))
+            ? BuildReportForPad(pad, cache)
+            : g_padState[(size_t)pad].report;
+    }
+    const int rebuiltPads = std::popcount((unsigned)rebuildMask);
+    g_padsRebuilt.fetch_add((uint64_t)rebuiltPads, std::memory_order_relaxed);
+    g_padsReused.fetch_add((uint64_t)(logicalPads - rebuiltPads), std::memory_order_relaxed);
 
-        g_lastRX[(size_t)pad].store(report.sThumbRX, std::memory_order_release);
-        g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_acq_rel);
-        g_lastReport[(size_t)pad] = report;
-        g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_release);
+    // Everything above read settings/bindings/curves; if a profile publish overlapped
+    // it, the reports may mix two profiles. Keep last tick's reports instead.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const bool configTorn = (configSeq & 1u) != 0 ||
+        g_configSeq.load(std::memory_order_relaxed) != configSeq;
+    if (configTorn)
+    {
+        g_configHeldTicks.fetch_add(1, std::memory_order_relaxed);
+        logicalPads = std::max(g_builtPadCount, 1);
+        g_incremental.valid = false;
     }
-    for (int pad = logicalPads; pad < kMaxVirtualPads; ++pad)
+    else
     {
-        XUSB_REPORT report{};
-        g_reports[(size_t)pad] = report;
+        g_incremental = incr;
+        for (int pad = 0; pad < logicalPads; ++pad)
+        {
+            const XUSB_REPORT& report = built[(size_t)pad];
+            g_padState[(size_t)pad].report = report;
+
+            g_lastRX[(size_t)pad].store(report.sThumbRX, std::memory_order_release);
+            PublishLastReport(pad, report);
+        }
+        // Pads removed since the last tick: publish neutral once, then leave them alone.
+        for (int pad = logicalPads; pad < g_builtPadCount; ++pad)
+        {
+            XUSB_REPORT report{};
+            g_padState[(size_t)pad].report = report;
 
-        g_lastRX[(size_t)pad].store(0, std::memory_order_release);
-        g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_acq_rel);
-        g_lastReport[(size_t)pad] = report;
-        g_lastSeq[(size_t)pad].fetch_add(1, std::memory_order_release);
+            g_lastRX[(size_t)pad].store(0, std::memory_order_release);
+            PublishLastReport(pad, report);
+        }
+        g_builtPadCount = logicalPads;
     }
 
-    if (g_virtualPadsEnabled.load(std::memory_order_acquire))
+    TickStage_Enter(stageClock, BackendTickStage_Submit);
+    if (!headless)
+        LogReportStatsThrottled(nowMs, logicalPads);
+    if (headless)
+    {
+        // Same change detection and pacing as the ViGEm path, without a driver call.
+        const int64_t now = QpcNow();
+        for (int i = 0; i < logicalPads; ++i)
+        {
+            SubmitDecision d = DecideReportSubmit(i, now);
+            CountReportDecision(i, d);
+            UpdatePacing(i, d);
+            if (IsSend(d))
+            {
+                MarkReportSent(i, NextReportToSend(g_padState[(size_t)i]), now, false);
+                sentMask |= (uint8_t)(1u << i);
+            }
+            else
+            {
+                suppressedMask |= (uint8_t)(1u << i);
+            }
+        }
+    }
+    else if (g_virtualPadsEnabled.load(std::memory_order_acquire))
     {
         if (g_client && g_connectedPadCount > 0) {
             VIGEM_ERROR err = VIGEM_ERROR_NONE;
             bool allOk = true;
-            DWORD now = GetTickCount();
-            constexpr DWORD kMinSendIntervalMs = 4;
-            constexpr DWORD kKeepAliveMs = 250;
+            const int64_t now = QpcNow();
 
             for (int i = 0; i < g_connectedPadCount; ++i)
             {
@@ -2108,30 +3234,31 @@ void Backend_Tick()
                 if (!pad) continue;
 
                 int idx = std::clamp(i, 0, kMaxVirtualPads - 1);
-                const XUSB_REPORT& report = g_reports[(size_t)idx];
-
-                bool valid = g_lastSentValid[(size_t)idx] != 0;
-                bool changed = !valid || IsReportSignificantlyDifferent(report, g_lastSentReports[(size_t)idx]);
-                DWORD elapsed = now - g_lastSentTicks[(size_t)idx];
-
-                if (!changed && elapsed < kKeepAliveMs)
-                    continue;
-                if (changed && elapsed < kMinSendIntervalMs)
+                SubmitDecision d = DecideReportSubmit(idx, now);
+                CountReportDecision(idx, d);
+                UpdatePacing(idx, d);
+                if (!IsSend(d))
+                {
+                    suppressedMask |= (uint8_t)(1u << idx);
                     continue;
+                }
 
-                err = vigem_target_x360_update(g_client, pad, report);
+                const XUSB_REPORT toSend = NextReportToSend(g_padState[(size_t)idx]);
+                ProgressCall_Enter(BackendCall_VigemUpdate);
+                err = vigem_target_x360_update(g_client, pad, toSend);
+                ProgressCall_Leave();
                 if (!VIGEM_SUCCESS(err))
                 {
                     allOk = false;
                     break;
                 }
 
-                g_lastSentReports[(size_t)idx] = report;
-                g_lastSentTicks[(size_t)idx] = now;
-                g_lastSentValid[(size_t)idx] = 1;
+                MarkReportSent(idx, toSend, now, false);
+                sentMask |= (uint8_t)(1u << idx);
             }
 
             if (!allOk) {
+                vigemFailed = true;
                 DebugLog_Write(L"[backend.tick] vigem update failed err=%d streak=%d", (int)err, g_vigemUpdateFailStreak + 1);
                 g_vigemOk.store(false, std::memory_order_release);
                 g_vigemLastErr.store(err, std::memory_order_release);
@@ -2163,6 +3290,16 @@ void Backend_Tick()
         g_vigemOk.store(true, std::memory_order_release);
         g_vigemLastErr.store(VIGEM_ERROR_NONE, std::memory_order_release);
     }
+
+    TickStage_Enter(stageClock, BackendTickStage_Count);
+    g_profileTicks.fetch_add(1, std::memory_order_relaxed);
+    RecordFlightFrame(tickStartQpc, stageClock.startQpc, cache, logicalPads,
+        sentMask, suppressedMask, vigemFailed, headless);
+
+    WootingStats_EndTick();
+    g_progressStageQpc.store(QpcNow(), std::memory_order_relaxed);
+    g_progressStage.store(-1, std::memory_order_relaxed);
+    g_progressTicks.fetch_add(1, std::memory_order_release);
 }
 
 SHORT Backend_GetLastRX() { return g_lastRX[0].load(std::memory_order_acquire); }
@@ -2172,15 +3309,14 @@ XUSB_REPORT Backend_GetLastReport()
     return Backend_GetLastReportForPad(0);
 }
 
-XUSB_REPORT Backend_GetLastReportForPad(int padIndex)
+static void ReadLastReport(int p, XUSB_REPORT* outReport, uint32_t* outSum)
 {
-    int p = std::clamp(padIndex, 0, kMaxVirtualPads - 1);
-    XUSB_REPORT r{};
     int spin = 0;
     for (;;) {
         uint32_t s1 = g_lastSeq[(size_t)p].load(std::memory_order_acquire);
         if (s1 & 1u)
         {
+            g_lastReportRetries.fetch_add(1, std::memory_order_relaxed);
             if (++spin < 256)
             {
 #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
@@ -2195,9 +3331,16 @@ XUSB_REPORT Backend_GetLastReportForPad(int padIndex)
             }
             continue;
         }
-        r = g_lastReport[(size_t)p];
+        XUSB_REPORT r = g_lastReport[(size_t)p];
+        uint32_t sum = g_lastReportSum[(size_t)p];
         uint32_t s2 = g_lastSeq[(size_t)p].load(std::memory_order_acquire);
-        if (s1 == s2) return r;
+        if (s1 == s2)
+        {
+            *outReport = r;
+            if (outSum) *outSum = sum;
+            return;
+        }
+        g_lastReportRetries.fetch_add(1, std::memory_order_relaxed);
         if (++spin < 256)
         {
 #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
@@ -2213,6 +3356,60 @@ XUSB_REPORT Backend_GetLastReportForPad(int padIndex)
     }
 }
 
+XUSB_REPORT Backend_GetLastReportForPad(int padIndex)
+{
+    int p = std::clamp(padIndex, 0, kMaxVirtualPads - 1);
+    XUSB_REPORT r{};
+    ReadLastReport(p, &r, nullptr);
+    return r;
+}
+
+bool Backend_ReadLastReportChecked(int padIndex, XUSB_REPORT* out)
+{
+    int p = std::clamp(padIndex, 0, kMaxVirtualPads - 1);
+    XUSB_REPORT r{};
+    uint32_t sum = 0;
+    ReadLastReport(p, &r, &sum);
+    if (out) *out = r;
+    if (ReportChecksum(r) == sum)
+        return true;
+    g_lastReportTorn.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+uint64_t Backend_GetLastReportRetryCount()
+{
+    return g_lastReportRetries.load(std::memory_order_relaxed);
+}
+
+uint64_t Backend_GetLastReportTornCount()
+{
+    return g_lastReportTorn.load(std::memory_order_relaxed);
+}
+
+void Backend_BeginConfigSwap()
+{
+    uint32_t s = g_configSeq.load(std::memory_order_relaxed);
+    g_configSeq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void Backend_EndConfigSwap()
+{
+    uint32_t s = g_configSeq.load(std::memory_order_relaxed);
+    g_configSeq.store(s + 1, std::memory_order_release);
+}
+
+uint32_t Backend_GetConfigGeneration()
+{
+    return g_configSeq.load(std::memory_order_acquire) >> 1;
+}
+
+uint64_t Backend_GetConfigHeldTicks()
+{
+    return g_configHeldTicks.load(std::memory_order_relaxed);
+}
+
 void BackendUI_SetTrackedHids(const uint16_t* hids, int count)
 {
     if (!hids || count <= 0) { BackendUI_ClearTrackedHids(); return; }
@@ -2369,18 +3566,27 @@ void Backend_NotifyKeyboardEvent(
     bool isKeyDown,
     bool isInjected)
 {
+    // Any event, injected or not, shows the hook is still installed.
+    g_lastKeyboardHookEventMs.store(GetTickCount64(), std::memory_order_relaxed);
     if (hidHint == 0 || isInjected) return;
 
     if (hidHint < 256)
     {
-        if (scanCode != 0) g_hidToScan[hidHint].store(scanCode, std::memory_order_relaxed);
-        if (vkCode != 0) g_hidToVk[hidHint].store(vkCode, std::memory_order_relaxed);
-
-        uint8_t prev = g_physicalDown[hidHint].load(std::memory_order_relaxed);
-        uint8_t now = isKeyDown ? 1u : 0u;
-        if (prev != now)
+        bool learned = false;
+        if (scanCode != 0 && g_hidToScan[hidHint].exchange(scanCode, std::memory_order_relaxed) != scanCode)
+            learned = true;
+        if (vkCode != 0 && g_hidToVk[hidHint].exchange(vkCode, std::memory_order_relaxed) != vkCode)
+            learned = true;
+        if (learned)
+            g_hidLearnSeq.fetch_add(1, std::memory_order_release);
+
+        const uint64_t bit = 1ULL << (hidHint & 63);
+        std::atomic<uint64_t>& chunk = g_physicalDown[hidHint >> 6];
+        const uint64_t prev = isKeyDown
+            ? chunk.fetch_or(bit, std::memory_order_relaxed)
+            : chunk.fetch_and(~bit, std::memory_order_relaxed);
+        if (((prev & bit) != 0) != isKeyDown)
         {
-            g_physicalDown[hidHint].store(now, std::memory_order_relaxed);
             if (kLogPhysicalKeyTransitions)
             {
                 DebugLog_Write(
@@ -2402,6 +3608,35 @@ void Backend_NotifyKeyboardEvent(
     g_keyboardEventSeq.fetch_add(1u, std::memory_order_release);
 }
 
+void Backend_SetKeyboardHookActive(bool active)
+{
+    if (active && !g_keyboardHookActive.load(std::memory_order_relaxed))
+    {
+        // Keys already held when the hook starts never send a down event.
+        for (int chunk = 0; chunk < 4; ++chunk)
+        {
+            uint64_t down = 0;
+            for (int bit = 0; bit < 64; ++bit)
+            {
+                if (IsHidDownViaAsyncState((uint16_t)(chunk * 64 + bit)))
+                    down |= 1ULL << bit;
+            }
+            g_physicalDown[(size_t)chunk].store(down, std::memory_order_relaxed);
+        }
+    }
+    if (active)
+    {
+        g_lastKeyboardHookEventMs.store(GetTickCount64(), std::memory_order_relaxed);
+        g_keyboardHookLost.store(false, std::memory_order_relaxed);
+    }
+    g_keyboardHookActive.store(active, std::memory_order_release);
+}
+
+bool Backend_ConsumeKeyboardHookLost()
+{
+    return g_keyboardHookLost.exchange(false, std::memory_order_acq_rel);
+}
+
 void Backend_AddMouseDelta(int dx, int dy)
 {
     if (dx != 0)
@@ -2480,4 +3715,271 @@ uint32_t Backend_GetLastInitIssues()
     return g_lastInitIssues.load(std::memory_order_acquire);
 }
 
+const wchar_t* Backend_GetTickStageName(int stage)
+{
+    switch (stage)
+    {
+    case BackendTickStage_Input: return L"input";
+    case BackendTickStage_Tracked: return L"tracked";
+    case BackendTickStage_BindCapture: return L"bind_capture";
+    case BackendTickStage_Reports: return L"reports";
+    case BackendTickStage_Submit: return L"submit";
+    case BackendTickStage_Count: return L"finish";
+    case -1: return L"wait";
+    default: return L"unknown";
+    }
+}
+
+void Backend_GetTickProfile(BackendTickProfile* out)
+{
+    if (!out) return;
+    BackendTickProfile p{};
+    p.ticks = g_profileTicks.load(std::memory_order_relaxed);
+    p.reportsSent = g_reportsSent.load(std::memory_order_relaxed);
+    p.reportsSuppressed = g_reportsSuppressed.load(std::memory_order_relaxed);
+    p.padsRebuilt = g_padsRebuilt.load(std::memory_order_relaxed);
+    p.padsReused = g_padsReused.load(std::memory_order_relaxed);
+    for (int i = 0; i < BackendTickStage_Count; ++i)
+    {
+        p.lastStageUs[i] = QpcToUs(g_stageLastQpc[(size_t)i].load(std::memory_order_relaxed));
+        p.totalStageUs[i] = QpcToUs(g_stageTotalQpc[(size_t)i].load(std::memory_order_relaxed));
+    }
+    *out = p;
+}
+
+void Backend_GetPadReportStats(int pad, BackendPadReportStats* out)
+{
+    if (!out) return;
+    *out = BackendPadReportStats{};
+    if (pad < 0 || pad >= kMaxVirtualPads) return;
+
+    const PadReportCounters& c = g_padReportCounters[(size_t)pad];
+    out->sent = c.sent.load(std::memory_order_relaxed);
+    out->sentFlush = c.sentFlush.load(std::memory_order_relaxed);
+    out->sentKeepAlive = c.sentKeepAlive.load(std::memory_order_relaxed);
+    out->heldUnchanged = c.heldUnchanged.load(std::memory_order_relaxed);
+    out->heldSmall = c.heldSmall.load(std::memory_order_relaxed);
+    out->heldPaced = c.heldPaced.load(std::memory_order_relaxed);
+    out->pacedDeferred = c.pacedDeferred.load(std::memory_order_relaxed);
+    out->pacedByTimer = c.pacedByTimer.load(std::memory_order_relaxed);
+    out->pacedByTick = c.pacedByTick.load(std::memory_order_relaxed);
+    out->pacedDropped = c.pacedDropped.load(std::memory_order_relaxed);
+    out->pacedLateUsTotal = c.pacedLateUsTotal.load(std::memory_order_relaxed);
+    out->pacedLateUsMax = c.pacedLateUsMax.load(std::memory_order_relaxed);
+}
+
+int64_t Backend_GetPacingDeadlineQpc()
+{
+    int64_t due = 0;
+    for (const PadState& ps : g_padState)
+    {
+        if (ps.pacedPending && (due == 0 || ps.pacedDueQpc < due))
+            due = ps.pacedDueQpc;
+    }
+    return due;
+}
+
+void Backend_FlushPacedReports()
+{
+    const int64_t now = QpcNow();
+    const bool headless = g_headless.load(std::memory_order_relaxed);
+    const bool vigemReady = !headless && g_virtualPadsEnabled.load(std::memory_order_acquire) && g_client;
+
+    for (int idx = 0; idx < kMaxVirtualPads; ++idx)
+    {
+        PadState& ps = g_padState[(size_t)idx];
+        if (!ps.pacedPending || now < ps.pacedDueQpc) continue;
+
+        const XUSB_REPORT toSend = NextReportToSend(ps);
+        if (!IsReportDifferent(toSend, ps.lastSent))
+        {
+            ps.pacedPending = 0;
+            g_padReportCounters[(size_t)idx].pacedDropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!headless)
+        {
+            // No target: leave it to the tick, which also owns reconnects.
+            PVIGEM_TARGET pad = (vigemReady && idx < g_connectedPadCount) ? g_pads[(size_t)idx] : nullptr;
+            if (!pad)
+            {
+                ps.pacedPending = 0;
+                continue;
+            }
+
+            ProgressCall_Enter(BackendCall_VigemUpdate);
+            VIGEM_ERROR err = vigem_target_x360_update(g_client, pad, toSend);
+            ProgressCall_Leave();
+            if (!VIGEM_SUCCESS(err))
+            {
+                // The report still differs from lastSent, so the next tick retries it.
+                DebugLog_Write(L"[backend.pacing] vigem update failed pad=%d err=%d", idx + 1, (int)err);
+                ps.pacedPending = 0;
+                continue;
+            }
+        }
+        MarkReportSent(idx, toSend, now, true);
+    }
+}
+
+void Backend_ResetTickProfile()
+{
+    g_profileTicks.store(0, std::memory_order_relaxed);
+    g_reportsSent.store(0, std::memory_order_relaxed);
+    g_reportsSuppressed.store(0, std::memory_order_relaxed);
+    g_padsRebuilt.store(0, std::memory_order_relaxed);
+    g_padsReused.store(0, std::memory_order_relaxed);
+    for (PadReportCounters& c : g_padReportCounters)
+    {
+        c.sent.store(0, std::memory_order_relaxed);
+        c.sentFlush.store(0, std::memory_order_relaxed);
+        c.sentKeepAlive.store(0, std::memory_order_relaxed);
+        c.heldUnchanged.store(0, std::memory_order_relaxed);
+        c.heldSmall.store(0, std::memory_order_relaxed);
+        c.heldPaced.store(0, std::memory_order_relaxed);
+        c.pacedDeferred.store(0, std::memory_order_relaxed);
+        c.pacedByTimer.store(0, std::memory_order_relaxed);
+        c.pacedByTick.store(0, std::memory_order_relaxed);
+        c.pacedDropped.store(0, std::memory_order_relaxed);
+        c.pacedLateUsTotal.store(0, std::memory_order_relaxed);
+        c.pacedLateUsMax.store(0, std::memory_order_relaxed);
+    }
+    for (auto& v : g_stageLastQpc) v.store(0, std::memory_order_relaxed);
+    for (auto& v : g_stageTotalQpc) v.store(0, std::memory_order_relaxed);
+}
+
+void BackendSim_SetRawMilli(uint16_t hid, uint16_t rawMilli)
+{
+    if (hid == 0 || hid >= 256) return;
+    g_simRawM[hid].store((uint16_t)std::min<int>(rawMilli, 1000), std::memory_order_relaxed);
+}
+
+void BackendSim_ClearAll()
+{
+    for (auto& v : g_simRawM) v.store(0, std::memory_order_relaxed);
+}
+
+const wchar_t* Backend_GetCallName(int call)
+{
+    switch (call)
+    {
+    case BackendCall_None: return L"none";
+    case BackendCall_WootingSdk: return L"wooting_sdk";
+    case BackendCall_AulaWrite: return L"aula_write";
+    case BackendCall_VigemUpdate: return L"vigem_update";
+    case BackendCall_VigemConnect: return L"vigem_connect";
+    default: return L"unknown";
+    }
+}
+
+void Backend_GetProgress(BackendProgress* out)
+{
+    if (!out) return;
+    BackendProgress p{};
+    p.ticks = g_progressTicks.load(std::memory_order_acquire);
+    p.stage = g_progressStage.load(std::memory_order_acquire);
+    p.call = g_progressCall.load(std::memory_order_relaxed);
+    p.stageEnterQpc = g_progressStageQpc.load(std::memory_order_relaxed);
+    *out = p;
+}
 
+static DWORD WINAPI NeutralizePadsThreadProc(LPVOID)
+{
+    int updated = 0;
+    if (TryAcquireSRWLockShared(&g_vigemLifecycleLock))
+    {
+        if (g_client)
+        {
+            XUSB_REPORT zero{};
+            int count = std::clamp(g_connectedPadCount, 0, kMaxVirtualPads);
+            for (int i = 0; i < count; ++i)
+            {
+                PVIGEM_TARGET pad = g_pads[(size_t)i];
+                if (pad && VIGEM_SUCCESS(vigem_target_x360_update(g_client, pad, zero)))
+                    ++updated;
+            }
+        }
+        ReleaseSRWLockShared(&g_vigemLifecycleLock);
+        if (updated > 0)
+            g_padsNeutralized.store(true, std::memory_order_release);
+        DebugLog_Write(L"[backend.watchdog] neutralized pads=%d", updated);
+    }
+    else
+    {
+        DebugLog_Write(L"[backend.watchdog] neutralize skipped (vigem create/destroy in progress)");
+    }
+    g_neutralizeInFlight.store(false, std::memory_order_release);
+    return 0;
+}
+
+bool Backend_NeutralizePadsAsync()
+{
+    if (g_headless.load(std::memory_order_acquire))
+        return false;
+    if (g_neutralizeInFlight.exchange(true, std::memory_order_acq_rel))
+        return false; // previous attempt still running (or hung in the driver)
+
+    // Short-lived thread: if the driver call hangs too, only that thread is stuck.
+    HANDLE h = CreateThread(nullptr, 0, NeutralizePadsThreadProc, nullptr, 0, nullptr);
+    if (!h)
+    {
+        g_neutralizeInFlight.store(false, std::memory_order_release);
+        DebugLog_Write(L"[backend.watchdog] neutralize thread failed err=%lu", GetLastError());
+        return false;
+    }
+    CloseHandle(h);
+    return true;
+}
+
+const wchar_t* Backend_GetWootingApiName(int api)
+{
+    switch (api)
+    {
+    case BackendWootingApi_ReadAnalog: return L"read_analog";
+    case BackendWootingApi_ReadAnalogDevice: return L"read_analog_device";
+    case BackendWootingApi_ReadFullBuffer: return L"read_full_buffer";
+    case BackendWootingApi_ReadFullBufferDevice: return L"read_full_buffer_device";
+    case BackendWootingApi_GetConnectedDevicesInfo: return L"get_connected_devices_info";
+    case BackendWootingApi_SetKeycodeMode: return L"set_keycode_mode";
+    case BackendWootingApi_Initialise: return L"initialise";
+    case BackendWootingApi_IsInitialised: return L"is_initialised";
+    case BackendWootingApi_Uninitialise: return L"uninitialise";
+    default: return L"unknown";
+    }
+}
+
+bool Backend_GetWootingApiStats(int api, BackendWootingApiStats* out)
+{
+    if (!out || api < 0 || api >= BackendWootingApi_Count) return false;
+    const WootingApiCounters& c = g_wootingApiStats[(size_t)api];
+    BackendWootingApiStats st{};
+    st.calls = c.calls.load(std::memory_order_relaxed);
+    st.errors = c.errors.load(std::memory_order_relaxed);
+    st.totalUs = QpcToUs(c.totalQpc.load(std::memory_order_relaxed));
+    st.worstUs = QpcToUs(c.worstQpc.load(std::memory_order_relaxed));
+    st.lastTickCalls = c.lastTick.load(std::memory_order_relaxed);
+    st.maxTickCalls = c.maxPerTick.load(std::memory_order_relaxed);
+    for (int b = 0; b < kBackendWootingLatencyBuckets; ++b)
+        st.latency[b] = c.latency[(size_t)b].load(std::memory_order_relaxed);
+    for (int e = 0; e < kBackendWootingErrorSlots; ++e)
+        st.errorCodes[e] = c.errorCodes[(size_t)e].load(std::memory_order_relaxed);
+    *out = st;
+    return true;
+}
+
+void Backend_ResetWootingApiStats()
+{
+    for (auto& c : g_wootingApiStats)
+    {
+        c.calls.store(0, std::memory_order_relaxed);
+        c.errors.store(0, std::memory_order_relaxed);
+        c.totalQpc.store(0, std::memory_order_relaxed);
+        c.worstQpc.store(0, std::memory_order_relaxed);
+        c.thisTick.store(0, std::memory_order_relaxed);
+        c.lastTick.store(0, std::memory_order_relaxed);
+        c.maxPerTick.store(0, std::memory_order_relaxed);
+        for (auto& b : c.latency) b.store(0, std::memory_order_relaxed);
+        for (auto& e : c.errorCodes) e.store(0, std::memory_order_relaxed);
+    }
+}
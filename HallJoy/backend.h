@@ -21,7 +21,7 @@ void Backend_Shutdown();
 void Backend_Tick();
 uint32_t Backend_GetLastInitIssues();
 
-// Virtual X360 gamepad count in ViGEm (1..4). Can be changed at runtime.
+// Virtual X360 gamepad count in ViGEm (1..BINDINGS_MAX_GAMEPADS). Can be changed at runtime.
 void Backend_SetVirtualGamepadCount(int count);
 int Backend_GetVirtualGamepadCount();
 void Backend_SetVirtualGamepadsEnabled(bool on);
@@ -31,6 +31,20 @@ SHORT Backend_GetLastRX();
 XUSB_REPORT Backend_GetLastReport();
 XUSB_REPORT Backend_GetLastReportForPad(int padIndex);
 
+// Diagnostics for the last-report seqlock (stress tools).
+// Checked read also verifies a checksum stored under the same sequence; false = torn read.
+bool Backend_ReadLastReportChecked(int padIndex, XUSB_REPORT* out);
+uint64_t Backend_GetLastReportRetryCount();
+uint64_t Backend_GetLastReportTornCount();
+
+// Config publish bracket (UI thread, not nested). Settings, bindings and per-key
+// curves are published between Begin and End; a tick that overlaps the bracket
+// keeps the previous reports, so no report is built from half of each profile.
+void Backend_BeginConfigSwap();
+void Backend_EndConfigSwap();
+uint32_t Backend_GetConfigGeneration(); // completed publishes
+uint64_t Backend_GetConfigHeldTicks();  // ticks that kept reports because of a publish
+
 // ---- UI snapshot API (HID < 256) ----
 
 // UI tells backend which HID codes are present on the Main page (so backend doesn't depend on UI/layout)
@@ -109,9 +123,143 @@ void Backend_NotifyKeyboardEvent(
     bool isKeyDown,
     bool isInjected);
 
+// The app's low-level keyboard hook is installed (true) or removed (false).
+// While it runs, digital fallback uses the key state tracked from
+// Backend_NotifyKeyboardEvent; otherwise it polls GetAsyncKeyState.
+void Backend_SetKeyboardHookActive(bool active);
+// True once after the realtime thread found the hook dropped by Windows (it then
+// polls again); the UI thread should remove and reinstall the hook.
+bool Backend_ConsumeKeyboardHookLost();
+
 // Feed raw mouse delta (from WM_INPUT) for Mouse->Stick path.
 void Backend_AddMouseDelta(int dx, int dy);
 
 // Feed mouse button/wheel input for mouse pseudo-bindings.
 void Backend_SetMouseBindButtonState(uint16_t mouseBindHid, bool down);
 void Backend_PulseMouseBindWheel(uint16_t mouseBindHid);
+
+// ---- Headless mode / tick profiling (bench tools) ----
+
+// Backend_Tick pipeline stages, in execution order.
+enum BackendTickStage : int
+{
+    BackendTickStage_Input = 0,  // hotplug, reconnect requests, full-buffer assist
+    BackendTickStage_Tracked,    // UI snapshot of tracked HIDs
+    BackendTickStage_BindCapture,
+    BackendTickStage_Reports,    // per-pad report build + publish
+    BackendTickStage_Submit,     // change detection, pacing, ViGEm update
+    BackendTickStage_Count,
+};
+
+const wchar_t* Backend_GetTickStageName(int stage);
+
+struct BackendTickProfile
+{
+    uint64_t ticks = 0;
+    uint64_t reportsSent = 0;       // reports handed to ViGEm (counted in headless mode too)
+    uint64_t reportsSuppressed = 0; // built but held back by change detection / pacing
+    uint64_t padsRebuilt = 0;       // pad reports rebuilt (some bound input changed)
+    uint64_t padsReused = 0;        // pad reports kept from last tick (inputs unchanged)
+    double lastStageUs[BackendTickStage_Count]{};  // most recent tick
+    double totalStageUs[BackendTickStage_Count]{}; // since last reset
+};
+
+void Backend_GetTickProfile(BackendTickProfile* out);
+void Backend_ResetTickProfile(); // also resets the per-pad report counters
+
+// Per-pad submit counters since the last reset (see SettingsReportPolicy).
+// sent includes sentFlush and sentKeepAlive; held* are the suppressed reports.
+struct BackendPadReportStats
+{
+    uint64_t sent = 0;
+    uint64_t sentFlush = 0;     // Adaptive: small change sent at its flush deadline
+    uint64_t sentKeepAlive = 0; // unchanged or small change resent after 250 ms
+    uint64_t heldUnchanged = 0;
+    uint64_t heldSmall = 0;     // change below the pad's stick / trigger thresholds
+    uint64_t heldPaced = 0;     // change within 4 ms of the previous send
+
+    // Send pacing: a held-back change is sent exactly when the interval expires.
+    uint64_t pacedDeferred = 0;    // changes that became a pending paced report
+    uint64_t pacedByTimer = 0;     // sent by Backend_FlushPacedReports
+    uint64_t pacedByTick = 0;      // sent by a tick that came first
+    uint64_t pacedDropped = 0;     // change reverted before it was due
+    uint64_t pacedLateUsTotal = 0; // sum of (send time - due time) over paced sends
+    uint64_t pacedLateUsMax = 0;
+};
+void Backend_GetPadReportStats(int pad, BackendPadReportStats* out);
+
+// Send pacing (realtime thread). A change inside the minimum send interval is
+// kept as the pad's pending report; the loop wakes at the returned QPC time
+// (0 = nothing pending) and calls Flush, which sends every report that is due.
+int64_t Backend_GetPacingDeadlineQpc();
+void Backend_FlushPacedReports();
+
+// Headless init: no ViGEm targets, no Wooting SDK, no Aula device.
+// Raw input comes only from BackendSim_SetRawMilli; the tick otherwise runs the
+// same pipeline, including change detection and send pacing.
+bool Backend_InitHeadless(int padCount);
+void BackendSim_SetRawMilli(uint16_t hid, uint16_t rawMilli); // HID 1..255, [0..1000]
+void BackendSim_ClearAll();
+
+// ---- Realtime progress (watchdog) ----
+
+// Blocking external call the realtime thread is currently inside, if any.
+enum BackendCall : int
+{
+    BackendCall_None = 0,
+    BackendCall_WootingSdk,
+    BackendCall_AulaWrite,
+    BackendCall_VigemUpdate,
+    BackendCall_VigemConnect, // ViGEm client/target create or destroy
+};
+
+const wchar_t* Backend_GetCallName(int call);
+
+struct BackendProgress
+{
+    uint64_t ticks = 0;       // completed Backend_Tick calls
+    int stage = -1;           // BackendTickStage, -1 = between ticks
+    int call = BackendCall_None;
+    int64_t stageEnterQpc = 0;
+};
+
+void Backend_GetProgress(BackendProgress* out);
+
+// Sends a zero report to every connected pad from a short-lived thread, so a
+// hung realtime thread does not leave buttons held. Returns false if skipped.
+bool Backend_NeutralizePadsAsync();
+
+// ---- Wooting SDK per-API accounting (telemetry) ----
+
+enum BackendWootingApi : int
+{
+    BackendWootingApi_ReadAnalog = 0,
+    BackendWootingApi_ReadAnalogDevice,
+    BackendWootingApi_ReadFullBuffer,
+    BackendWootingApi_ReadFullBufferDevice,
+    BackendWootingApi_GetConnectedDevicesInfo,
+    BackendWootingApi_SetKeycodeMode,
+    BackendWootingApi_Initialise,
+    BackendWootingApi_IsInitialised,
+    BackendWootingApi_Uninitialise,
+    BackendWootingApi_Count,
+};
+
+constexpr int kBackendWootingLatencyBuckets = 16; // log2 us: [0,1) [1,2) [2,4) ... [16384,inf)
+constexpr int kBackendWootingErrorSlots = 12;     // 0..10 = WootingAnalogResult -2000..-1990, 11 = SEH fault
+
+struct BackendWootingApiStats
+{
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+    double totalUs = 0.0;
+    double worstUs = 0.0;
+    uint32_t lastTickCalls = 0; // calls made during the last completed tick
+    uint32_t maxTickCalls = 0;
+    uint64_t latency[kBackendWootingLatencyBuckets]{};
+    uint64_t errorCodes[kBackendWootingErrorSlots]{};
+};
+
+const wchar_t* Backend_GetWootingApiName(int api);
+bool Backend_GetWootingApiStats(int api, BackendWootingApiStats* out);
+void Backend_ResetWootingApiStats();
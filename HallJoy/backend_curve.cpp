@@ -5,6 +5,7 @@
 #include <array>
 #include <atomic>
 #include <cmath>
+#include <intrin.h>
 
 #include "curve_math.h"
 #include "key_settings.h"
@@ -24,7 +25,12 @@ struct CurveDef
     bool invert = false;
 };
 
-static std::atomic<uint64_t> g_curveCacheStamp{ 1 };
+// Sampled once per tick by BackendCurve_BeginTick, so every HID in a tick sees
+// the same curves. Cached curves live until one of these moves.
+static std::atomic<uint64_t> g_curveKeyGeneration{ 0 };
+static std::atomic<uint64_t> g_curveSettingsVersion{ 0 };
+static CurveDef              g_tickGlobalCurve{};          // realtime thread, set by BackendCurve_BeginTick
+static bool                  g_tickGlobalCurveReady = false;
 
 static float Clamp01(float v) { return std::clamp(v, 0.0f, 1.0f); }
 
@@ -85,91 +91,109 @@ static CurveDef NormalizeCurveDef(CurveDef c)
     return c;
 }
 
+// Built from the tick's own snapshot, so curves and the other tick settings
+// (SOCD, LKP, fallback, ...) always come from the same publish.
+static CurveDef BuildGlobalCurveSnapshot(const SettingsSnapshot& st)
+{
+    CurveDef c{};
+    c.invert = st.inputInvert;
+    c.mode = st.inputCurveMode;
+
+    c.x0 = st.inputDeadzoneLow;
+    c.x3 = st.inputDeadzoneHigh;
+    c.y0 = st.inputAntiDeadzone;
+    c.y3 = st.inputOutputCap;
+
+    c.x1 = st.inputBezierCp1X;
+    c.y1 = st.inputBezierCp1Y;
+    c.x2 = st.inputBezierCp2X;
+    c.y2 = st.inputBezierCp2Y;
+
+    c.w1 = st.inputBezierCp1W;
+    c.w2 = st.inputBezierCp2W;
+    return NormalizeCurveDef(c);
+}
+
+static CurveDef CurveFromKey(const KeyDeadzone& ks)
+{
+    CurveDef c{};
+    c.invert = ks.invert;
+    c.mode = (UINT)(ks.curveMode == 0 ? 0 : 1);
+    c.x0 = ks.low;   c.y0 = ks.antiDeadzone;
+    c.x1 = ks.cp1_x; c.y1 = ks.cp1_y;
+    c.x2 = ks.cp2_x; c.y2 = ks.cp2_y;
+    c.x3 = ks.high;  c.y3 = ks.outputCap;
+    c.w1 = ks.cp1_w;
+    c.w2 = ks.cp2_w;
+    return NormalizeCurveDef(c);
+}
+
 struct CurveThreadCache
 {
-    uint64_t stamp = 0;
-    bool globalReady = false;
+    uint64_t keyGeneration = 0;
+    uint64_t settingsVersion = ~0ull;
+    bool ready = false;
     CurveDef globalCurve{};
-    std::array<uint8_t, 256> hasCurve{};
+    KeySettingsFastCopy keys{};           // keys.uniqueMask selects curves[]
     std::array<CurveDef, 256> curves{};
 };
 
 static CurveThreadCache& GetCurveThreadCache()
 {
     static thread_local CurveThreadCache c;
-    uint64_t stamp = g_curveCacheStamp.load(std::memory_order_relaxed);
-    if (c.stamp != stamp)
+    uint64_t keyGen = g_curveKeyGeneration.load(std::memory_order_relaxed);
+    uint64_t settingsVer = g_curveSettingsVersion.load(std::memory_order_relaxed);
+    if (!c.ready || c.keyGeneration != keyGen || c.settingsVersion != settingsVer)
     {
-        c.stamp = stamp;
-        c.globalReady = false;
-        c.hasCurve.fill(0u);
+        c.keyGeneration = keyGen;
+        c.settingsVersion = settingsVer;
+        c.ready = true;
+        c.globalCurve = g_tickGlobalCurve;
+
+        // One bulk copy of all overridden keys instead of a record read per HID per tick.
+        KeySettings_CopyFast(&c.keys);
+        for (int w = 0; w < 4; ++w)
+        {
+            uint64_t bits = c.keys.uniqueMask[(size_t)w];
+            while (bits)
+            {
+                unsigned long bit = 0;
+                _BitScanForward64(&bit, bits);
+                bits &= bits - 1;
+                size_t hid = (size_t)w * 64u + bit;
+                c.curves[hid] = CurveFromKey(c.keys.keys[hid]);
+            }
+        }
     }
     return c;
 }
 
-static CurveDef BuildGlobalCurveSnapshot()
-{
-    CurveDef c{};
-    c.invert = Settings_GetInputInvert();
-    c.mode = Settings_GetInputCurveMode();
-
-    c.x0 = Settings_GetInputDeadzoneLow();
-    c.x3 = Settings_GetInputDeadzoneHigh();
-    c.y0 = Settings_GetInputAntiDeadzone();
-    c.y3 = Settings_GetInputOutputCap();
-
-    c.x1 = Settings_GetInputBezierCp1X();
-    c.y1 = Settings_GetInputBezierCp1Y();
-    c.x2 = Settings_GetInputBezierCp2X();
-    c.y2 = Settings_GetInputBezierCp2Y();
-
-    c.w1 = Settings_GetInputBezierCp1W();
-    c.w2 = Settings_GetInputBezierCp2W();
-    return NormalizeCurveDef(c);
-}
-
 static CurveDef BuildCurveForHid(uint16_t hid)
 {
     CurveThreadCache& cache = GetCurveThreadCache();
-    if (hid < 256 && cache.hasCurve[hid] != 0)
-        return cache.curves[hid];
-
-    CurveDef c{};
-    if (KeySettings_GetUseUnique(hid))
-    {
-        KeyDeadzone ks = KeySettings_Get(hid);
-        c.invert = ks.invert;
-        c.mode = (UINT)(ks.curveMode == 0 ? 0 : 1);
-        c.x0 = ks.low;   c.y0 = ks.antiDeadzone;
-        c.x1 = ks.cp1_x; c.y1 = ks.cp1_y;
-        c.x2 = ks.cp2_x; c.y2 = ks.cp2_y;
-        c.x3 = ks.high;  c.y3 = ks.outputCap;
-        c.w1 = ks.cp1_w;
-        c.w2 = ks.cp2_w;
-        c = NormalizeCurveDef(c);
-    }
-    else
-    {
-        if (!cache.globalReady)
-        {
-            cache.globalCurve = BuildGlobalCurveSnapshot();
-            cache.globalReady = true;
-        }
-        c = cache.globalCurve;
-    }
-
     if (hid < 256)
     {
-        cache.curves[hid] = c;
-        cache.hasCurve[hid] = 1u;
+        if (cache.keys.uniqueMask[hid >> 6] & (1ull << (hid & 63)))
+            return cache.curves[hid];
+        return cache.globalCurve;
     }
-    return c;
+
+    // HID >= 256: rare, slow path (map lookup).
+    if (KeySettings_GetUseUnique(hid))
+        return CurveFromKey(KeySettings_Get(hid));
+    return cache.globalCurve;
 }
 }
 
-void BackendCurve_BeginTick()
+void BackendCurve_BeginTick(const SettingsSnapshot& s)
 {
-    g_curveCacheStamp.fetch_add(1u, std::memory_order_relaxed);
+    g_curveKeyGeneration.store(KeySettings_GetGeneration(), std::memory_order_relaxed);
+    if (!g_tickGlobalCurveReady || s.version != g_curveSettingsVersion.load(std::memory_order_relaxed))
+    {
+        g_tickGlobalCurve = BuildGlobalCurveSnapshot(s);
+        g_tickGlobalCurveReady = true;
+        g_curveSettingsVersion.store(s.version, std::memory_order_relaxed);
+    }
 }
 
 float BackendCurve_ApplyByHid(uint16_t hid, float x01Raw)
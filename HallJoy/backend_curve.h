@@ -2,6 +2,9 @@
 
 #include <cstdint>
 
-void BackendCurve_BeginTick();
+struct SettingsSnapshot;
+
+// Call on the realtime thread with the tick's settings snapshot.
+void BackendCurve_BeginTick(const SettingsSnapshot& s);
 float BackendCurve_ApplyByHid(uint16_t hid, float x01Raw);
 
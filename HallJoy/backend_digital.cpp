@@ -0,0 +1,142 @@
+#define NOMINMAX
+#include "backend_digital.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "key_settings.h"
+
+namespace
+{
+enum : uint8_t
+{
+    DigitalFlag_RapidTrigger = 1u << 0,
+    DigitalFlag_Raw = 1u << 1,
+};
+
+static constexpr int kMaxKeys = 256;
+
+// Config, refreshed when KeySettings' generation moves.
+static uint64_t g_keyGeneration = 0;
+static std::array<uint8_t, 256> g_flags{};
+static std::array<float, 256> g_press{};
+static std::array<float, 256> g_release{};
+static std::array<float, 256> g_rtDelta{};
+static bool g_anyRapid = false;
+
+// State: down bit and, for rapid trigger, the travel extreme since the last
+// transition (minimum while up, maximum while down).
+static std::array<uint32_t, 256> g_down{};
+static std::array<float, 256> g_extreme{};
+
+static void ReloadConfig()
+{
+    g_anyRapid = false;
+    for (uint16_t hid = 1; hid < 256; ++hid)
+    {
+        const KeyDigital d = KeySettings_Get(hid).digital;
+        uint8_t f = 0;
+        if (d.rapidTrigger) f |= DigitalFlag_RapidTrigger;
+        if (d.rapidTrigger && d.rtRaw) f |= DigitalFlag_Raw;
+
+        // Mode change: restart from released so no stale extreme carries over.
+        if (f != g_flags[hid])
+        {
+            g_down[hid] = 0;
+            g_extreme[hid] = 0.0f;
+        }
+        g_flags[hid] = f;
+        g_press[hid] = d.pressPoint;
+        g_release[hid] = d.releasePoint;
+        g_rtDelta[hid] = d.rtDelta;
+        g_anyRapid |= d.rapidTrigger;
+    }
+}
+
+static bool RapidStep(uint16_t hid, float v01)
+{
+    const float delta = g_rtDelta[hid];
+    float& extreme = g_extreme[hid];
+    if (!g_down[hid])
+    {
+        extreme = std::min(extreme, v01);
+        if (v01 >= g_press[hid] && v01 >= extreme + delta)
+        {
+            extreme = v01;
+            return true;
+        }
+        return false;
+    }
+
+    extreme = std::max(extreme, v01);
+    if (v01 < g_release[hid] || v01 <= extreme - delta)
+    {
+        extreme = v01;
+        return false;
+    }
+    return true;
+}
+}
+
+void BackendDigital_BeginTick()
+{
+    uint64_t gen = KeySettings_GetGeneration();
+    if (gen == g_keyGeneration) return;
+    g_keyGeneration = gen;
+    ReloadConfig();
+}
+
+bool BackendDigital_UsesRaw(uint16_t hid)
+{
+    return hid < 256 && (g_flags[hid] & DigitalFlag_Raw) != 0;
+}
+
+void BackendDigital_Evaluate(const uint16_t* hids, const float* v01, int count, uint8_t* down)
+{
+    count = std::clamp(count, 0, kMaxKeys);
+
+    // Gather into dense lanes, then one branch-free hysteresis pass the
+    // compiler can vectorize: down = v >= press || (wasDown && v >= release).
+    alignas(32) float press[kMaxKeys];
+    alignas(32) float release[kMaxKeys];
+    alignas(32) uint32_t was[kMaxKeys];
+    alignas(32) uint32_t now[kMaxKeys];
+    for (int i = 0; i < count; ++i)
+    {
+        const uint8_t h = (uint8_t)hids[i];
+        press[i] = g_press[h];
+        release[i] = g_release[h];
+        was[i] = g_down[h];
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        const uint32_t p = (v01[i] >= press[i]) ? 1u : 0u;
+        const uint32_t r = (v01[i] >= release[i]) ? 1u : 0u;
+        now[i] = p | (was[i] & r);
+    }
+
+    // Rapid-trigger keys are rare; override their lanes with the scalar tracker.
+    if (g_anyRapid)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const uint16_t h = hids[i];
+            if (h < 256 && (g_flags[h] & DigitalFlag_RapidTrigger))
+                now[i] = RapidStep(h, v01[i]) ? 1u : 0u;
+        }
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        g_down[(uint8_t)hids[i]] = now[i];
+        down[i] = (uint8_t)now[i];
+    }
+}
+
+void BackendDigital_Reset()
+{
+    g_down.fill(0);
+    g_extreme.fill(0.0f);
+}
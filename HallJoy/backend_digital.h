@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// Button (digital) state of HIDs < 256, realtime thread only.
+// Every key has a press point and a lower release point (hysteresis), so a key
+// resting near the actuation depth does not toggle the button every tick.
+// Keys with KeyDigital::rapidTrigger additionally track their travel extreme
+// since the last transition and flip state when the travel reverses by rtDelta.
+
+// Picks up KeySettings changes (cheap when nothing moved).
+void BackendDigital_BeginTick();
+
+// True if Evaluate should be given the raw value for this key.
+bool BackendDigital_UsesRaw(uint16_t hid);
+
+// Advances `count` distinct keys by one tick in one pass and writes their
+// states (0/1) to `down`. `v01[i]` is the raw value if UsesRaw(hids[i]),
+// else the curve output. Call at most once per HID per tick; count <= 256.
+void BackendDigital_Evaluate(const uint16_t* hids, const float* v01, int count, uint8_t* down);
+
+// Forget all per-key state (keys read as released).
+void BackendDigital_Reset();
@@ -0,0 +1,133 @@
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "backend_predict.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+// Samples in the velocity window (~3 ms at 1 kHz polling).
+static constexpr int kHist = 4;
+// Travel below / above which the key is treated as at rest / bottomed out.
+static constexpr float kRestEdge = 0.03f;
+static constexpr float kFullEdge = 0.97f;
+// History older than this is dropped (key not read for a while).
+static constexpr double kStaleSec = 0.02;
+
+static bool g_enabled = false;
+static float g_horizonSec = 0.002f;
+static int64_t g_nowQpc = 0;
+static double g_secPerQpc = 0.0;
+
+// Flat per-HID ring of recent samples; g_head is the slot of the newest one.
+static std::array<std::array<float, kHist>, 256> g_x{};
+static std::array<std::array<int64_t, kHist>, 256> g_t{};
+static std::array<uint8_t, 256> g_count{};
+static std::array<uint8_t, 256> g_head{};
+
+// Last Apply per HID, for the bench's overshoot metrics.
+static std::array<float, 256> g_lastIn{};
+static std::array<float, 256> g_lastOut{};
+static std::array<int64_t, 256> g_lastQpc{};
+}
+
+void BackendPredict_BeginTick(const SettingsSnapshot& s, int64_t nowQpc)
+{
+    if (g_secPerQpc == 0.0)
+    {
+        LARGE_INTEGER f{};
+        QueryPerformanceFrequency(&f);
+        g_secPerQpc = (f.QuadPart > 0) ? (1.0 / (double)f.QuadPart) : 0.0;
+    }
+
+    if (s.inputPrediction && !g_enabled)
+        BackendPredict_Reset();
+
+    g_enabled = s.inputPrediction;
+    g_horizonSec = std::clamp(s.inputPredictionHorizonMs, 0.0f, 5.0f) / 1000.0f;
+    g_nowQpc = nowQpc;
+}
+
+float BackendPredict_Apply(uint16_t hid, float x01)
+{
+    if (!g_enabled || hid == 0 || hid >= 256) return x01;
+
+    auto& xs = g_x[hid];
+    auto& ts = g_t[hid];
+    uint8_t& count = g_count[hid];
+    uint8_t& head = g_head[hid];
+
+    if (count > 0 && (double)(g_nowQpc - ts[head]) * g_secPerQpc > kStaleSec)
+        count = 0;
+
+    head = (uint8_t)((head + 1) % kHist);
+    xs[head] = x01;
+    ts[head] = g_nowQpc;
+    if (count < kHist) ++count;
+
+    float out = x01;
+    if (count >= 2 && x01 > kRestEdge && x01 < kFullEdge)
+    {
+        // Only extrapolate a monotonic run; a reversal inside the window is
+        // where a predictor overshoots the most.
+        int dir = 0;
+        bool monotonic = true;
+        for (int i = 1; i < count; ++i)
+        {
+            const float d = xs[(size_t)((head + kHist - i + 1) % kHist)] - xs[(size_t)((head + kHist - i) % kHist)];
+            const int sd = (d > 0.0f) - (d < 0.0f);
+            if (sd == 0) continue;
+            if (dir != 0 && sd != dir) { monotonic = false; break; }
+            dir = sd;
+        }
+
+        const size_t oldest = (size_t)((head + kHist - (count - 1)) % kHist);
+        const double span = (double)(ts[head] - ts[oldest]) * g_secPerQpc;
+        if (monotonic && dir != 0 && span > 0.0)
+        {
+            const float velocity = (float)((double)(x01 - xs[oldest]) / span);
+            out = std::clamp(x01 + velocity * g_horizonSec, 0.0f, 1.0f);
+        }
+    }
+
+    g_lastIn[hid] = x01;
+    g_lastOut[hid] = out;
+    g_lastQpc[hid] = g_nowQpc;
+    return out;
+}
+
+bool BackendPredict_IsSettled(uint16_t hid)
+{
+    if (!g_enabled || hid == 0 || hid >= 256) return true;
+
+    const auto& xs = g_x[hid];
+    const uint8_t head = g_head[hid];
+    if (g_count[hid] > 0 && g_lastOut[hid] != xs[head]) return false;
+    for (int i = 1; i < g_count[hid]; ++i)
+    {
+        if (xs[(size_t)((head + kHist - i) % kHist)] != xs[head])
+            return false;
+    }
+    return true;
+}
+
+bool BackendPredict_GetLast(uint16_t hid, float* in01, float* out01)
+{
+    if (!g_enabled || hid == 0 || hid >= 256 || g_lastQpc[hid] != g_nowQpc) return false;
+    if (in01) *in01 = g_lastIn[hid];
+    if (out01) *out01 = g_lastOut[hid];
+    return true;
+}
+
+void BackendPredict_Reset()
+{
+    g_count.fill(0);
+    g_head.fill(0);
+    g_lastQpc.fill(0);
+}
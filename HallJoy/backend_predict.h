@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+struct SettingsSnapshot;
+
+// Short-horizon extrapolation of analog key travel (HIDs < 256), realtime
+// thread only. Each key keeps its last few (value, QPC time) samples; while the
+// key moves steadily in one direction its output is pushed ahead by
+// velocity * horizon, partly cancelling the fixed SDK -> tick -> ViGEm delay.
+// Near rest and near full press, and whenever the recent samples reverse
+// direction, the input passes through unchanged.
+
+// Latches the prediction settings and the tick's QPC time.
+void BackendPredict_BeginTick(const SettingsSnapshot& s, int64_t nowQpc);
+
+// Returns the predicted value for one key; call at most once per HID per tick.
+float BackendPredict_Apply(uint16_t hid, float x01);
+
+// True when the key's window is flat and its last output was not pushed ahead,
+// so repeating the newest sample changes nothing (or prediction is off).
+bool BackendPredict_IsSettled(uint16_t hid);
+
+// Bench: input and output of the key's Apply call if it ran this tick.
+bool BackendPredict_GetLast(uint16_t hid, float* in01, float* out01);
+
+// Drops all sample history.
+void BackendPredict_Reset();
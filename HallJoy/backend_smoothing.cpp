@@ -0,0 +1,110 @@
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "backend_smoothing.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+// Cutoff of the speed estimate itself (standard One Euro value).
+static constexpr float kDerivCutoffHz = 1.0f;
+// A key not read for this long restarts from its current value.
+static constexpr float kStaleSec = 0.1f;
+static constexpr float kTwoPi = 6.28318530718f;
+// Below one stick step (1/32767): the filter counts as converged.
+static constexpr float kSettledEps = 1.0e-5f;
+
+static bool g_enabled = false;
+static float g_minCutoffHz = 1.0f;
+static float g_beta = 2.0f;
+static int64_t g_nowQpc = 0;
+static double g_secPerQpc = 0.0;
+
+// Flat per-HID state: filtered value, filtered speed (units/s), last sample time.
+static std::array<float, 256> g_x{};
+static std::array<float, 256> g_dx{};
+static std::array<int64_t, 256> g_lastQpc{};
+
+static float Alpha(float cutoffHz, float dtSec)
+{
+    const float tau = 1.0f / (kTwoPi * cutoffHz);
+    return 1.0f / (1.0f + tau / dtSec);
+}
+}
+
+void BackendSmoothing_BeginTick(const SettingsSnapshot& s, int64_t nowQpc)
+{
+    if (g_secPerQpc == 0.0)
+    {
+        LARGE_INTEGER f{};
+        QueryPerformanceFrequency(&f);
+        g_secPerQpc = (f.QuadPart > 0) ? (1.0 / (double)f.QuadPart) : 0.0;
+    }
+
+    // Turning it on must not blend against values from before it was off.
+    if (s.inputSmoothing && !g_enabled)
+        BackendSmoothing_Reset();
+
+    g_enabled = s.inputSmoothing;
+    g_minCutoffHz = std::max(s.inputSmoothingMinCutoffHz, 0.1f);
+    g_beta = std::max(s.inputSmoothingBeta, 0.0f);
+    g_nowQpc = nowQpc;
+}
+
+bool BackendSmoothing_Enabled()
+{
+    return g_enabled;
+}
+
+float BackendSmoothing_Apply(uint16_t hid, float raw01)
+{
+    if (!g_enabled || hid == 0 || hid >= 256) return raw01;
+
+    const int64_t last = g_lastQpc[hid];
+    g_lastQpc[hid] = g_nowQpc;
+    const float dt = (float)((double)(g_nowQpc - last) * g_secPerQpc);
+
+    // Released keys read exactly 0 so pads always return to neutral.
+    if (last == 0 || !(dt > 0.0f) || dt > kStaleSec || raw01 <= 0.0f)
+    {
+        g_x[hid] = raw01;
+        g_dx[hid] = 0.0f;
+        return raw01;
+    }
+
+    const float prev = g_x[hid];
+    const float speed = (raw01 - prev) / dt;
+    const float dx = g_dx[hid] + Alpha(kDerivCutoffHz, dt) * (speed - g_dx[hid]);
+    const float cutoff = g_minCutoffHz + g_beta * std::fabs(dx);
+    const float x = prev + Alpha(cutoff, dt) * (raw01 - prev);
+
+    g_dx[hid] = dx;
+    g_x[hid] = x;
+    return x;
+}
+
+bool BackendSmoothing_IsSettled(uint16_t hid, float raw01)
+{
+    if (!g_enabled || hid == 0 || hid >= 256) return true;
+    return std::fabs(g_x[hid] - raw01) <= kSettledEps;
+}
+
+void BackendSmoothing_MarkSampled(uint16_t hid)
+{
+    if (!g_enabled || hid == 0 || hid >= 256) return;
+    if (g_lastQpc[hid] != 0)
+        g_lastQpc[hid] = g_nowQpc;
+}
+
+void BackendSmoothing_Reset()
+{
+    g_x.fill(0.0f);
+    g_dx.fill(0.0f);
+    g_lastQpc.fill(0);
+}
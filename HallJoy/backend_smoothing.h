@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+struct SettingsSnapshot;
+
+// One Euro filter on analog key values (HIDs < 256), realtime thread only.
+// A low-pass whose cutoff rises with travel speed: still keys are smoothed
+// hard (sensor noise stops reaching the sticks), fast presses pass almost
+// unfiltered. Each key keeps its own QPC timestamp, so dt stays correct for
+// keys that are not read every tick.
+
+// Latches the smoothing settings and the tick's QPC time.
+void BackendSmoothing_BeginTick(const SettingsSnapshot& s, int64_t nowQpc);
+
+// True when smoothing is on this tick.
+bool BackendSmoothing_Enabled();
+
+// Filters one key's raw value; call at most once per HID per tick.
+float BackendSmoothing_Apply(uint16_t hid, float raw01);
+
+// True when Apply(hid, raw01) would not move the key's output any more: the
+// filter has converged on raw01 (or smoothing is off). The backend skips
+// recomputing settled keys whose input did not change.
+bool BackendSmoothing_IsSettled(uint16_t hid, float raw01);
+
+// Records a settled key as sampled this tick without filtering it, so a key
+// skipped while at rest does not go stale and its next change is still smoothed.
+// Only valid when IsSettled(hid, raw01) holds; an Apply later in the same tick
+// then passes raw01 through, which is where the filter already sits.
+void BackendSmoothing_MarkSampled(uint16_t hid);
+
+// Drops all filter state (next sample of every key passes through).
+void BackendSmoothing_Reset();
@@ -2,6 +2,8 @@
 
 #include "bindings.h"
 
+#include <intrin.h>
+
 void BindingActions_ApplyForPad(int padIndex, BindAction a, uint16_t hid)
 {
     if (!hid) return;
@@ -55,56 +57,21 @@ void BindingActions_Apply(BindAction a, uint16_t hid)
     BindingActions_ApplyForPad(0, a, hid);
 }
 
+static_assert((int)BindAction::Trigger_LT == 8 && (int)BindAction::Btn_A == 10 && (int)BindAction::Btn_DR == 24,
+    "BindAction order must match the Bindings_GetHidActionMaskForPad bit layout");
+
 bool BindingActions_TryGetByHidForPad(int padIndex, uint16_t hid, BindAction& outAction)
 {
     if (!hid) return false;
 
-    // Axes
-    auto ax = [&](Axis a, BindAction minusA, BindAction plusA) -> bool
-        {
-            AxisBinding b = Bindings_GetAxisForPad(padIndex, a);
-            if (hid == b.minusHid) { outAction = minusA; return true; }
-            if (hid == b.plusHid) { outAction = plusA;  return true; }
-            return false;
-        };
-
-    if (ax(Axis::LX, BindAction::Axis_LX_Minus, BindAction::Axis_LX_Plus)) return true;
-    if (ax(Axis::LY, BindAction::Axis_LY_Minus, BindAction::Axis_LY_Plus)) return true;
-    if (ax(Axis::RX, BindAction::Axis_RX_Minus, BindAction::Axis_RX_Plus)) return true;
-    if (ax(Axis::RY, BindAction::Axis_RY_Minus, BindAction::Axis_RY_Plus)) return true;
-
-    // Triggers
-    if (hid == Bindings_GetTriggerForPad(padIndex, Trigger::LT)) { outAction = BindAction::Trigger_LT; return true; }
-    if (hid == Bindings_GetTriggerForPad(padIndex, Trigger::RT)) { outAction = BindAction::Trigger_RT; return true; }
-
-    // Buttons (mask-based)
-    auto bt = [&](GameButton b, BindAction a) -> bool
-        {
-            if (Bindings_ButtonHasHidForPad(padIndex, b, hid)) { outAction = a; return true; }
-            return false;
-        };
-
-    if (bt(GameButton::A, BindAction::Btn_A)) return true;
-    if (bt(GameButton::B, BindAction::Btn_B)) return true;
-    if (bt(GameButton::X, BindAction::Btn_X)) return true;
-    if (bt(GameButton::Y, BindAction::Btn_Y)) return true;
-
-    if (bt(GameButton::LB, BindAction::Btn_LB)) return true;
-    if (bt(GameButton::RB, BindAction::Btn_RB)) return true;
-
-    if (bt(GameButton::Back, BindAction::Btn_Back)) return true;
-    if (bt(GameButton::Start, BindAction::Btn_Start)) return true;
-    if (bt(GameButton::Guide, BindAction::Btn_Guide)) return true;
-
-    if (bt(GameButton::LS, BindAction::Btn_LS)) return true;
-    if (bt(GameButton::RS, BindAction::Btn_RS)) return true;
-
-    if (bt(GameButton::DpadUp, BindAction::Btn_DU)) return true;
-    if (bt(GameButton::DpadDown, BindAction::Btn_DD)) return true;
-    if (bt(GameButton::DpadLeft, BindAction::Btn_DL)) return true;
-    if (bt(GameButton::DpadRight, BindAction::Btn_DR)) return true;
-
-    return false;
+    // Lowest bit wins: axes, then triggers, then buttons (same precedence as before).
+    uint32_t mask = Bindings_GetHidActionMaskForPad(padIndex, hid);
+    if (!mask) return false;
+
+    unsigned long bit = 0;
+    _BitScanForward(&bit, mask);
+    outAction = (BindAction)bit;
+    return true;
 }
 
 bool BindingActions_TryGetByHid(uint16_t hid, BindAction& outAction)
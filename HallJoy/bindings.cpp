@@ -4,6 +4,7 @@
 #include <atomic>
 #include <cstdint>
 #include <algorithm>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -38,16 +39,86 @@ static std::array<std::array<std::atomic<uint16_t>, 2>, BINDINGS_MAX_GAMEPADS> g
 
 // Buttons: 14 buttons * 4 chunks (0..255)
 static std::array<std::array<std::array<std::atomic<uint64_t>, 4>, 15>, BINDINGS_MAX_GAMEPADS> g_btnMask{};
-// Pad accent/color identity (1..4), kept separate from pad index so removing a middle pad
+// Pad accent/color identity (1..BINDINGS_MAX_GAMEPADS), kept separate from pad index so removing a middle pad
 // does not force remaining pads to change visual identity.
-static std::array<int, BINDINGS_MAX_GAMEPADS> g_padStyle{ 1, 2, 3, 4 };
+static std::array<int, BINDINGS_MAX_GAMEPADS> g_padStyle{ 1, 2, 3, 4, 5, 6, 7, 8 };
 
 static int ClampStyleVariant(int v) { return std::clamp(v, 1, BINDINGS_MAX_GAMEPADS); }
 
+// ---- Reverse index (HID < 256) ----
+// Per pad: action bits bound to each HID (see Bindings_GetHidActionMaskForPad),
+// plus per-pad and "bound on any pad" bitsets. Readers are lock-free; all writers
+// take g_writeMutex so a setter's storage update and its reindex stay paired.
+static std::array<std::array<std::atomic<uint32_t>, 256>, BINDINGS_MAX_GAMEPADS> g_hidActions{};
+static std::array<std::array<std::atomic<uint64_t>, 4>, BINDINGS_MAX_GAMEPADS> g_boundOnPad{};
+static std::array<std::atomic<uint64_t>, 4> g_boundAnywhere{};
+// Bumped after every reindex (see Bindings_GetGeneration).
+static std::atomic<uint64_t> g_generation{ 0 };
+static std::mutex g_writeMutex;
+
+static constexpr int kActionBitTrigger0 = 8;
+static constexpr int kActionBitButton0 = 10;
+
+static uint32_t ScanHidActionsForPad(int padIndex, uint16_t hid)
+{
+    uint32_t mask = 0;
+    for (int a = 0; a < 4; ++a)
+    {
+        AxisBinding b = UnpackAxis(g_axes[(size_t)padIndex][(size_t)a].load(std::memory_order_acquire));
+        if (b.minusHid == hid) mask |= 1u << (a * 2);
+        if (b.plusHid == hid) mask |= 1u << (a * 2 + 1);
+    }
+    for (int t = 0; t < 2; ++t)
+    {
+        if (g_triggers[(size_t)padIndex][(size_t)t].load(std::memory_order_acquire) == hid)
+            mask |= 1u << (kActionBitTrigger0 + t);
+    }
+    if (hid < 256)
+    {
+        const uint64_t bit = 1ULL << (hid % 64);
+        for (int b = 0; b < 15; ++b)
+        {
+            if (g_btnMask[(size_t)padIndex][(size_t)b][hid / 64].load(std::memory_order_acquire) & bit)
+                mask |= 1u << (kActionBitButton0 + b);
+        }
+    }
+    return mask;
+}
+
+// Writer only (g_writeMutex held).
+static void ReindexHid(int padIndex, uint16_t hid)
+{
+    if (hid != 0 && hid < 256)
+    {
+        const uint32_t actions = ScanHidActionsForPad(padIndex, hid);
+        g_hidActions[(size_t)padIndex][hid].store(actions, std::memory_order_release);
+
+        bool any = false;
+        for (int p = 0; p < BINDINGS_MAX_GAMEPADS && !any; ++p)
+            any = g_hidActions[(size_t)p][hid].load(std::memory_order_relaxed) != 0;
+
+        const uint64_t bit = 1ULL << (hid % 64);
+        if (actions) g_boundOnPad[(size_t)padIndex][hid / 64].fetch_or(bit, std::memory_order_release);
+        else         g_boundOnPad[(size_t)padIndex][hid / 64].fetch_and(~bit, std::memory_order_release);
+        if (any) g_boundAnywhere[hid / 64].fetch_or(bit, std::memory_order_release);
+        else     g_boundAnywhere[hid / 64].fetch_and(~bit, std::memory_order_release);
+    }
+
+    // Also for HID >= 256: the axis/trigger storage itself changed.
+    g_generation.fetch_add(1, std::memory_order_release);
+}
+
+static void ReindexPad(int padIndex)
+{
+    for (uint16_t hid = 1; hid < 256; ++hid)
+        ReindexHid(padIndex, hid);
+}
+
 // ---- Axes ----
 void Bindings_SetAxisMinusForPad(int padIndex, Axis a, uint16_t hid)
 {
     if (!IsValidPadIndex(padIndex)) return;
+    std::lock_guard lock(g_writeMutex);
     auto& atom = g_axes[(size_t)padIndex][AxisIdx(a)];
     uint32_t old = atom.load(std::memory_order_relaxed);
     for (;;)
@@ -55,13 +126,18 @@ void Bindings_SetAxisMinusForPad(int padIndex, Axis a, uint16_t hid)
         AxisBinding b = UnpackAxis(old);
         uint32_t nw = PackAxis(hid, b.plusHid);
         if (atom.compare_exchange_weak(old, nw, std::memory_order_release, std::memory_order_relaxed))
+        {
+            ReindexHid(padIndex, b.minusHid);
+            ReindexHid(padIndex, hid);
             return;
+        }
     }
 }
 
 void Bindings_SetAxisPlusForPad(int padIndex, Axis a, uint16_t hid)
 {
     if (!IsValidPadIndex(padIndex)) return;
+    std::lock_guard lock(g_writeMutex);
     auto& atom = g_axes[(size_t)padIndex][AxisIdx(a)];
     uint32_t old = atom.load(std::memory_order_relaxed);
     for (;;)
@@ -69,7 +145,11 @@ void Bindings_SetAxisPlusForPad(int padIndex, Axis a, uint16_t hid)
         AxisBinding b = UnpackAxis(old);
         uint32_t nw = PackAxis(b.minusHid, hid);
         if (atom.compare_exchange_weak(old, nw, std::memory_order_release, std::memory_order_relaxed))
+        {
+            ReindexHid(padIndex, b.plusHid);
+            ReindexHid(padIndex, hid);
             return;
+        }
     }
 }
 
@@ -88,7 +168,10 @@ AxisBinding Bindings_GetAxis(Axis a) { return Bindings_GetAxisForPad(0, a); }
 void Bindings_SetTriggerForPad(int padIndex, Trigger t, uint16_t hid)
 {
     if (!IsValidPadIndex(padIndex)) return;
-    g_triggers[(size_t)padIndex][TrigIdx(t)].store(hid, std::memory_order_release);
+    std::lock_guard lock(g_writeMutex);
+    uint16_t prev = g_triggers[(size_t)padIndex][TrigIdx(t)].exchange(hid, std::memory_order_acq_rel);
+    ReindexHid(padIndex, prev);
+    ReindexHid(padIndex, hid);
 }
 
 uint16_t Bindings_GetTriggerForPad(int padIndex, Trigger t)
@@ -115,7 +198,9 @@ void Bindings_AddButtonHidForPad(int padIndex, GameButton b, uint16_t hid)
     int chunk = 0, bit = 0;
     if (!HidToChunkBit(hid, chunk, bit)) return;
 
+    std::lock_guard lock(g_writeMutex);
     g_btnMask[(size_t)padIndex][BtnIdx(b)][chunk].fetch_or(1ULL << bit, std::memory_order_release);
+    ReindexHid(padIndex, hid);
 }
 
 void Bindings_RemoveButtonHidForPad(int padIndex, GameButton b, uint16_t hid)
@@ -124,7 +209,9 @@ void Bindings_RemoveButtonHidForPad(int padIndex, GameButton b, uint16_t hid)
     int chunk = 0, bit = 0;
     if (!HidToChunkBit(hid, chunk, bit)) return;
 
+    std::lock_guard lock(g_writeMutex);
     g_btnMask[(size_t)padIndex][BtnIdx(b)][chunk].fetch_and(~(1ULL << bit), std::memory_order_release);
+    ReindexHid(padIndex, hid);
 }
 
 bool Bindings_ButtonHasHidForPad(int padIndex, GameButton b, uint16_t hid)
@@ -184,6 +271,10 @@ void Bindings_ClearHidForPad(int padIndex, uint16_t hid)
     if (!IsValidPadIndex(padIndex)) return;
     if (!hid) return;
 
+    std::lock_guard lock(g_writeMutex);
+    if (hid < 256 && g_hidActions[(size_t)padIndex][hid].load(std::memory_order_acquire) == 0)
+        return;
+
     // axes (packed CAS update)
     for (auto& atom : g_axes[(size_t)padIndex])
     {
@@ -224,6 +315,8 @@ void Bindings_ClearHidForPad(int padIndex, uint16_t hid)
             btn[chunk].fetch_and(mask, std::memory_order_release);
         }
     }
+
+    ReindexHid(padIndex, hid);
 }
 
 bool Bindings_IsHidBoundForPad(int padIndex, uint16_t hid)
@@ -231,6 +324,10 @@ bool Bindings_IsHidBoundForPad(int padIndex, uint16_t hid)
     if (!IsValidPadIndex(padIndex)) return false;
     if (!hid) return false;
 
+    if (hid < 256)
+        return g_hidActions[(size_t)padIndex][hid].load(std::memory_order_acquire) != 0;
+
+    // HID >= 256: axes/triggers only, not indexed.
     for (int i = 0; i < 4; ++i)
     {
         AxisBinding a = UnpackAxis(g_axes[(size_t)padIndex][(size_t)i].load(std::memory_order_acquire));
@@ -244,21 +341,30 @@ bool Bindings_IsHidBoundForPad(int padIndex, uint16_t hid)
             return true;
     }
 
-    if (hid < 256)
-    {
-        const int chunk = (int)(hid / 64);
-        const int bit = (int)(hid % 64);
-        const uint64_t mask = (1ULL << bit);
-        for (size_t b = 0; b < g_btnMask[(size_t)padIndex].size(); ++b)
-        {
-            if (g_btnMask[(size_t)padIndex][b][(size_t)chunk].load(std::memory_order_acquire) & mask)
-                return true;
-        }
-    }
-
     return false;
 }
 
+uint64_t Bindings_GetBoundMaskChunkForPad(int padIndex, int chunk)
+{
+    if (!IsValidPadIndex(padIndex)) return 0;
+    if (chunk < 0 || chunk >= 4) return 0;
+    return g_boundOnPad[(size_t)padIndex][(size_t)chunk].load(std::memory_order_acquire);
+}
+
+uint64_t Bindings_GetGeneration()
+{
+    return g_generation.load(std::memory_order_acquire);
+}
+
+uint32_t Bindings_GetHidActionMaskForPad(int padIndex, uint16_t hid)
+{
+    if (!IsValidPadIndex(padIndex)) return 0;
+    if (hid == 0) return 0;
+    if (hid < 256)
+        return g_hidActions[(size_t)padIndex][hid].load(std::memory_order_acquire);
+    return ScanHidActionsForPad(padIndex, hid);
+}
+
 void Bindings_SetPadStyleVariant(int padIndex, int styleVariant)
 {
     if (!IsValidPadIndex(padIndex)) return;
@@ -325,6 +431,7 @@ void Bindings_RemovePadAndCompact(int removePadIndex, int activePadCount)
     if (removePadIndex <= 0) return; // pad #1 is always present
     if (removePadIndex >= activePadCount) return;
 
+    std::lock_guard lock(g_writeMutex);
     for (int p = removePadIndex; p < activePadCount - 1; ++p)
     {
         CopyPadBindingsAtomic(p, p + 1);
@@ -332,6 +439,8 @@ void Bindings_RemovePadAndCompact(int removePadIndex, int activePadCount)
     }
 
     ClearPadBindingsAtomic(activePadCount - 1);
+    for (int p = removePadIndex; p < activePadCount; ++p)
+        ReindexPad(p);
 
     // Keep a stable pool of unique style ids among active pads.
     bool used[BINDINGS_MAX_GAMEPADS + 1]{};
@@ -348,6 +457,38 @@ void Bindings_RemovePadAndCompact(int removePadIndex, int activePadCount)
     g_padStyle[(size_t)(activePadCount - 1)] = freeSv;
 }
 
+void Bindings_Export(BindingsImage* out)
+{
+    if (!out) return;
+    for (int p = 0; p < BINDINGS_MAX_GAMEPADS; ++p)
+    {
+        for (int a = 0; a < 4; ++a)
+            out->axes[p][a] = g_axes[(size_t)p][(size_t)a].load(std::memory_order_acquire);
+        for (int t = 0; t < 2; ++t)
+            out->triggers[p][t] = g_triggers[(size_t)p][(size_t)t].load(std::memory_order_acquire);
+        for (int b = 0; b < 15; ++b)
+            for (int c = 0; c < 4; ++c)
+                out->buttons[p][b][c] = g_btnMask[(size_t)p][(size_t)b][(size_t)c].load(std::memory_order_acquire);
+    }
+}
+
+void Bindings_Import(const BindingsImage& in)
+{
+    std::lock_guard lock(g_writeMutex);
+    for (int p = 0; p < BINDINGS_MAX_GAMEPADS; ++p)
+    {
+        for (int a = 0; a < 4; ++a)
+            g_axes[(size_t)p][(size_t)a].store(in.axes[p][a], std::memory_order_release);
+        for (int t = 0; t < 2; ++t)
+            g_triggers[(size_t)p][(size_t)t].store(in.triggers[p][t], std::memory_order_release);
+        for (int b = 0; b < 15; ++b)
+            for (int c = 0; c < 4; ++c)
+                g_btnMask[(size_t)p][(size_t)b][(size_t)c].store(in.buttons[p][b][c], std::memory_order_release);
+    }
+    for (int p = 0; p < BINDINGS_MAX_GAMEPADS; ++p)
+        ReindexPad(p);
+}
+
 void Bindings_ClearHid(uint16_t hid)
 {
     for (int pad = 0; pad < BINDINGS_MAX_GAMEPADS; ++pad)
@@ -356,6 +497,10 @@ void Bindings_ClearHid(uint16_t hid)
 
 bool Bindings_IsHidBound(uint16_t hid)
 {
+    if (hid == 0) return false;
+    if (hid < 256)
+        return (g_boundAnywhere[hid / 64].load(std::memory_order_acquire) & (1ULL << (hid % 64))) != 0;
+
     for (int pad = 0; pad < BINDINGS_MAX_GAMEPADS; ++pad)
     {
         if (Bindings_IsHidBoundForPad(pad, hid))
@@ -30,7 +30,7 @@ enum class GameButton
     DpadUp, DpadDown, DpadLeft, DpadRight
 };
 
-constexpr int BINDINGS_MAX_GAMEPADS = 4;
+constexpr int BINDINGS_MAX_GAMEPADS = 8;
 
 // ---- Per-gamepad API ----
 void Bindings_SetAxisMinusForPad(int padIndex, Axis a, uint16_t hid);
@@ -49,8 +49,21 @@ uint16_t Bindings_GetButtonForPad(int padIndex, GameButton b);
 void Bindings_ClearHidForPad(int padIndex, uint16_t hid);
 bool Bindings_IsHidBoundForPad(int padIndex, uint16_t hid);
 
+// Reverse index: every action this HID drives on the pad, one bit per action in
+// BindAction order (bits 0..7 axes LX-,LX+,LY-,LY+,RX-,RX+,RY-,RY+; 8..9 LT,RT;
+// 10..24 buttons in GameButton order). O(1) for HID < 256, lock-free.
+uint32_t Bindings_GetHidActionMaskForPad(int padIndex, uint16_t hid);
+
+// Every HID < 256 bound to anything on the pad (axis, trigger or button),
+// as 4 x 64-bit chunks like the button masks. Lock-free.
+uint64_t Bindings_GetBoundMaskChunkForPad(int padIndex, int chunk);
+
+// Changes whenever any pad's bindings change (after the new values are
+// visible), so per-pad data derived from bindings can be cached.
+uint64_t Bindings_GetGeneration();
+
 // Visual style (accent color identity) bound to pad slot.
-// styleVariant: 1..4
+// styleVariant: 1..BINDINGS_MAX_GAMEPADS
 void Bindings_SetPadStyleVariant(int padIndex, int styleVariant);
 int  Bindings_GetPadStyleVariant(int padIndex);
 
@@ -95,6 +108,18 @@ uint16_t Bindings_GetButton(GameButton b);
 // across ALL virtual gamepads.
 void Bindings_ClearHid(uint16_t hid);
 
+// Plain copy of every pad's bindings (compiled profile cache).
+struct BindingsImage
+{
+    uint32_t axes[BINDINGS_MAX_GAMEPADS][4];        // minusHid | plusHid << 16
+    uint16_t triggers[BINDINGS_MAX_GAMEPADS][2];    // LT, RT
+    uint64_t buttons[BINDINGS_MAX_GAMEPADS][15][4]; // HID bit masks, 4 x 64
+};
+void Bindings_Export(BindingsImage* out);
+// Replaces all pads' bindings under one writer lock and rebuilds the reverse
+// index once, instead of one reindex per setter call.
+void Bindings_Import(const BindingsImage& in);
+
 // Returns true if HID is used by any gamepad binding (axis/trigger/button).
-// across ALL virtual gamepads.
+// across ALL virtual gamepads. O(1) for HID < 256 (safe from the LL keyboard hook).
 bool Bindings_IsHidBound(uint16_t hid);
@@ -0,0 +1,296 @@
+// flight_recorder.cpp
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "flight_recorder.h"
+#include "debug_log.h"
+#include "win_util.h"
+
+static constexpr uint32_t kFlightRingSize = 4096; // power of two
+static constexpr DWORD kPostTriggerMs = 500;      // keep recording a bit after the anomaly
+static constexpr ULONGLONG kAutoDumpCooldownMs = 30000;
+static constexpr uint32_t kMaxAutoDumpsPerSession = 20;
+
+struct FlightSlot
+{
+    std::atomic<uint32_t> seq{ 0 };
+    FlightFrame frame{};
+};
+
+static std::array<FlightSlot, kFlightRingSize> g_ring{};
+static std::atomic<uint64_t> g_written{ 0 };
+static std::atomic<uint32_t> g_budgetUs{ 0 };
+
+static std::atomic<uint32_t> g_pendingReasons{ 0 };
+static std::atomic<int64_t> g_triggerQpc{ 0 };
+
+static std::atomic<HANDLE> g_dumpEvent{ nullptr }; // auto-reset
+static HANDLE g_stopEvent = nullptr;
+static HANDLE g_worker = nullptr;
+
+static ULONGLONG g_lastAutoDumpMs = 0;
+static uint32_t g_autoDumpCount = 0;
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+void FlightRecorder_Push(const FlightFrame& frame)
+{
+    uint64_t n = g_written.load(std::memory_order_relaxed);
+    FlightSlot& slot = g_ring[(size_t)(n & (kFlightRingSize - 1u))];
+    slot.seq.fetch_add(1u, std::memory_order_acq_rel); // odd => writer in progress
+    slot.frame = frame;
+    slot.seq.fetch_add(1u, std::memory_order_release);
+    g_written.store(n + 1, std::memory_order_release);
+}
+
+void FlightRecorder_SetBudgetUs(uint32_t us)
+{
+    g_budgetUs.store(us, std::memory_order_relaxed);
+}
+
+uint32_t FlightRecorder_GetBudgetUs()
+{
+    return g_budgetUs.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder_RequestDump(uint32_t reasons)
+{
+    if (reasons == FlightDumpReason_None) return;
+
+    int64_t expected = 0;
+    g_triggerQpc.compare_exchange_strong(expected, QpcNow(), std::memory_order_relaxed);
+    g_pendingReasons.fetch_or(reasons, std::memory_order_release);
+
+    HANDLE ev = g_dumpEvent.load(std::memory_order_acquire);
+    if (ev) SetEvent(ev);
+}
+
+static bool CopySlot(uint64_t index, FlightFrame& out)
+{
+    const FlightSlot& slot = g_ring[(size_t)(index & (kFlightRingSize - 1u))];
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        uint32_t s1 = slot.seq.load(std::memory_order_acquire);
+        if (s1 & 1u) { YieldProcessor(); continue; }
+        out = slot.frame;
+        uint32_t s2 = slot.seq.load(std::memory_order_acquire);
+        if (s1 == s2) return true;
+    }
+    return false;
+}
+
+static void AppendReasons(std::string& s, uint32_t reasons)
+{
+    struct { uint32_t bit; const char* name; } const names[] = {
+        { FlightDumpReason_OverBudget, "over_budget" },
+        { FlightDumpReason_VigemFail, "vigem_fail" },
+        { FlightDumpReason_SdkFault, "sdk_fault" },
+        { FlightDumpReason_Hotkey, "hotkey" },
+        { FlightDumpReason_Stall, "stall" },
+    };
+    bool first = true;
+    for (const auto& n : names)
+    {
+        if (!(reasons & n.bit)) continue;
+        if (!first) s += ',';
+        s += n.name;
+        first = false;
+    }
+    if (first) s += "none";
+}
+
+static void AppendFrame(std::string& s, const FlightFrame& f, int64_t triggerQpc, double msPerQpc)
+{
+    char buf[256];
+    int len = snprintf(buf, sizeof(buf), "%10.3f %6u [%u %u %u %u %u] %c%c%c%c %u",
+        (double)(f.qpc - triggerQpc) * msPerQpc,
+        (unsigned)f.tickUs,
+        (unsigned)f.stageUs[0], (unsigned)f.stageUs[1], (unsigned)f.stageUs[2],
+        (unsigned)f.stageUs[3], (unsigned)f.stageUs[4],
+        (f.flags & FlightFrameFlag_OverBudget) ? 'B' : '-',
+        (f.flags & FlightFrameFlag_VigemFail) ? 'V' : '-',
+        (f.flags & FlightFrameFlag_SdkFaulted) ? 'S' : '-',
+        (f.flags & FlightFrameFlag_Headless) ? 'H' : '-',
+        (unsigned)f.padCount);
+    if (len > 0) s.append(buf, (size_t)std::min(len, (int)sizeof(buf) - 1));
+
+    // One sent / suppressed digit per pad, pad 0 first.
+    int pads = std::clamp((int)f.padCount, 0, kFlightMaxPads);
+    s += ' ';
+    for (int p = 0; p < pads; ++p) s += ((f.sentMask >> p) & 1u) ? '1' : '0';
+    if (pads == 0) s += '-';
+    s += ' ';
+    for (int p = 0; p < pads; ++p) s += ((f.suppressedMask >> p) & 1u) ? '1' : '0';
+    if (pads == 0) s += '-';
+
+    for (int p = 0; p < pads; ++p)
+    {
+        const FlightPadReport& r = f.pads[p];
+        len = snprintf(buf, sizeof(buf), " | p%d %04X %u %u %d %d %d %d",
+            p, (unsigned)r.buttons, (unsigned)r.lt, (unsigned)r.rt,
+            (int)r.lx, (int)r.ly, (int)r.rx, (int)r.ry);
+        if (len > 0) s.append(buf, (size_t)std::min(len, (int)sizeof(buf) - 1));
+    }
+
+    s += " |";
+    int hids = std::clamp((int)f.hidCount, 0, kFlightMaxHids);
+    for (int i = 0; i < hids; ++i)
+    {
+        const FlightHidSample& h = f.hids[i];
+        len = snprintf(buf, sizeof(buf), " %u:%u/%u",
+            (unsigned)h.hid, (unsigned)h.rawM, (unsigned)h.filteredM);
+        if (len > 0) s.append(buf, (size_t)std::min(len, (int)sizeof(buf) - 1));
+    }
+    s += "\r\n";
+}
+
+static void WriteDump(uint32_t reasons, int64_t triggerQpc)
+{
+    uint64_t end = g_written.load(std::memory_order_acquire);
+    uint64_t count = std::min<uint64_t>(end, kFlightRingSize - 1u); // skip the slot being written
+    uint64_t begin = end - count;
+
+    std::vector<FlightFrame> frames;
+    frames.reserve((size_t)count);
+    for (uint64_t i = begin; i < end; ++i)
+    {
+        FlightFrame f{};
+        if (CopySlot(i, f)) frames.push_back(f);
+    }
+
+    LARGE_INTEGER freq{};
+    QueryPerformanceFrequency(&freq);
+    const double msPerQpc = (freq.QuadPart > 0) ? (1000.0 / (double)freq.QuadPart) : 0.0;
+    if (triggerQpc == 0 && !frames.empty()) triggerQpc = frames.back().qpc;
+
+    SYSTEMTIME st{};
+    GetLocalTime(&st);
+    wchar_t name[64]{};
+    swprintf_s(name, L"flight_%04u%02u%02u_%02u%02u%02u.txt",
+        st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
+    std::wstring path = WinUtil_BuildPathNearExe(name);
+
+    std::string s;
+    s.reserve(frames.size() * 160 + 512);
+    s += "# HallJoy flight recorder\r\n# reasons=";
+    AppendReasons(s, reasons);
+    char head[256];
+    int len = snprintf(head, sizeof(head),
+        "\r\n# frames=%zu budget_us=%u; t_ms is relative to the trigger\r\n"
+        "# t_ms tick_us [input tracked bind_capture reports submit] flags(B=over budget V=vigem fail S=sdk faulted H=headless) pads sent(p0..pN) suppressed(p0..pN)"
+        " | pN buttons lt rt lx ly rx ry | hid:raw/filtered (milli)\r\n",
+        frames.size(), (unsigned)g_budgetUs.load(std::memory_order_relaxed));
+    if (len > 0) s.append(head, (size_t)std::min(len, (int)sizeof(head) - 1));
+    for (const FlightFrame& f : frames)
+        AppendFrame(s, f, triggerQpc, msPerQpc);
+
+    HANDLE h = CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (h == INVALID_HANDLE_VALUE)
+    {
+        DebugLog_Write(L"[flight] dump open failed err=%lu path=%s", GetLastError(), path.c_str());
+        return;
+    }
+    DWORD written = 0;
+    BOOL ok = WriteFile(h, s.data(), (DWORD)s.size(), &written, nullptr);
+    CloseHandle(h);
+    DebugLog_Write(L"[flight] dump reasons=0x%X frames=%zu ok=%d path=%s",
+        reasons, frames.size(), ok ? 1 : 0, path.c_str());
+}
+
+static DWORD WINAPI FlightWorkerProc(LPVOID)
+{
+    HANDLE handles[2] = { g_stopEvent, g_dumpEvent.load(std::memory_order_acquire) };
+    for (;;)
+    {
+        DWORD w = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+        if (w != WAIT_OBJECT_0 + 1)
+            return 0;
+
+        // Let the ring capture what happens right after the trigger too.
+        if (WaitForSingleObject(g_stopEvent, kPostTriggerMs) == WAIT_OBJECT_0)
+            return 0;
+
+        uint32_t reasons = g_pendingReasons.exchange(0, std::memory_order_acq_rel);
+        int64_t triggerQpc = g_triggerQpc.exchange(0, std::memory_order_relaxed);
+        if (reasons == FlightDumpReason_None)
+            continue;
+
+        if (!(reasons & FlightDumpReason_Hotkey))
+        {
+            ULONGLONG now = GetTickCount64();
+            if (g_autoDumpCount >= kMaxAutoDumpsPerSession ||
+                (g_lastAutoDumpMs != 0 && now - g_lastAutoDumpMs < kAutoDumpCooldownMs))
+            {
+                DebugLog_Write(L"[flight] auto dump skipped reasons=0x%X (rate limit)", reasons);
+                continue;
+            }
+            g_lastAutoDumpMs = now;
+            ++g_autoDumpCount;
+        }
+
+        WriteDump(reasons, triggerQpc);
+    }
+}
+
+void FlightRecorder_Init()
+{
+    if (g_worker) return;
+
+    g_pendingReasons.store(0, std::memory_order_relaxed);
+    g_triggerQpc.store(0, std::memory_order_relaxed);
+    g_lastAutoDumpMs = 0;
+    g_autoDumpCount = 0;
+
+    g_stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    HANDLE dumpEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (!g_stopEvent || !dumpEvent)
+    {
+        DebugLog_Write(L"[flight] CreateEvent failed err=%lu", GetLastError());
+        if (g_stopEvent) { CloseHandle(g_stopEvent); g_stopEvent = nullptr; }
+        if (dumpEvent) CloseHandle(dumpEvent);
+        return;
+    }
+    g_dumpEvent.store(dumpEvent, std::memory_order_release);
+
+    g_worker = CreateThread(nullptr, 0, FlightWorkerProc, nullptr, 0, nullptr);
+    if (!g_worker)
+    {
+        DebugLog_Write(L"[flight] CreateThread failed err=%lu", GetLastError());
+        g_dumpEvent.store(nullptr, std::memory_order_release);
+        CloseHandle(dumpEvent);
+        CloseHandle(g_stopEvent);
+        g_stopEvent = nullptr;
+        return;
+    }
+    SetThreadPriority(g_worker, THREAD_PRIORITY_BELOW_NORMAL);
+    DebugLog_Write(L"[flight] recorder ready frames=%u", kFlightRingSize);
+}
+
+void FlightRecorder_Shutdown()
+{
+    if (!g_worker) return;
+
+    SetEvent(g_stopEvent);
+    WaitForSingleObject(g_worker, INFINITE);
+    CloseHandle(g_worker);
+    g_worker = nullptr;
+
+    HANDLE dumpEvent = g_dumpEvent.exchange(nullptr, std::memory_order_acq_rel);
+    if (dumpEvent) CloseHandle(dumpEvent);
+    CloseHandle(g_stopEvent);
+    g_stopEvent = nullptr;
+}
@@ -0,0 +1,73 @@
+// flight_recorder.h
+#pragma once
+#include <cstdint>
+
+// Always-on ring of compact per-tick frames (~4 s at 1 ms polling).
+// Writer: realtime thread only (FlightRecorder_Push). Dumps are written by a
+// worker thread to "flight_<date>_<time>.txt" near the exe, so the tick never
+// touches the disk.
+
+enum FlightDumpReason : uint32_t
+{
+    FlightDumpReason_None = 0,
+    FlightDumpReason_OverBudget = 1u << 0,
+    FlightDumpReason_VigemFail = 1u << 1,
+    FlightDumpReason_SdkFault = 1u << 2,
+    FlightDumpReason_Hotkey = 1u << 3,
+    FlightDumpReason_Stall = 1u << 4,  // realtime watchdog
+};
+
+enum FlightFrameFlag : uint8_t
+{
+    FlightFrameFlag_OverBudget = 1u << 0,
+    FlightFrameFlag_VigemFail = 1u << 1,
+    FlightFrameFlag_SdkFaulted = 1u << 2,
+    FlightFrameFlag_Headless = 1u << 3,
+};
+
+constexpr int kFlightMaxPads = 8;  // >= BINDINGS_MAX_GAMEPADS
+constexpr int kFlightMaxHids = 16; // active HIDs kept per frame
+constexpr int kFlightStages = 5;   // matches BackendTickStage_Count
+
+struct FlightPadReport
+{
+    uint16_t buttons;
+    uint8_t lt;
+    uint8_t rt;
+    int16_t lx, ly, rx, ry;
+};
+
+struct FlightHidSample
+{
+    uint16_t hid;
+    uint16_t rawM;      // [0..1000]
+    uint16_t filteredM; // [0..1000], after invert/curve
+};
+
+struct FlightFrame
+{
+    int64_t qpc;                        // tick start
+    uint32_t tickUs;
+    uint16_t stageUs[kFlightStages];    // saturated at 65535
+    uint8_t padCount;
+    uint8_t sentMask;                   // bit per pad: report handed to ViGEm
+    uint8_t suppressedMask;             // bit per pad: held back by change detection / pacing
+    uint8_t flags;                      // FlightFrameFlag
+    uint8_t hidCount;
+    FlightPadReport pads[kFlightMaxPads];
+    FlightHidSample hids[kFlightMaxHids];
+};
+
+// Starts/stops the dump worker. Frames are recorded even without it (bench tools).
+void FlightRecorder_Init();
+void FlightRecorder_Shutdown();
+
+// Realtime thread only. Copies one frame into the ring.
+void FlightRecorder_Push(const FlightFrame& frame);
+
+// Tick budget used by the backend for the over-budget trigger (0 = off).
+void FlightRecorder_SetBudgetUs(uint32_t us);
+uint32_t FlightRecorder_GetBudgetUs();
+
+// Any thread, lock-free. Automatic reasons are rate-limited; Hotkey is not.
+void FlightRecorder_RequestDump(uint32_t reasons);
@@ -0,0 +1,89 @@
+// foreground_watch.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <string>
+
+#include "foreground_watch.h"
+#include "debug_log.h"
+
+static HWINEVENTHOOK g_hook = nullptr;
+static ForegroundChangedFn g_fn = nullptr;
+static void* g_ctx = nullptr;
+static DWORD g_lastPid = 0;
+
+static bool QueryImagePath(DWORD pid, std::wstring& out)
+{
+    out.clear();
+    HANDLE h = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+    if (!h) return false;
+
+    wchar_t buf[MAX_PATH * 2]{};
+    DWORD len = (DWORD)_countof(buf);
+    bool ok = QueryFullProcessImageNameW(h, 0, buf, &len) != FALSE;
+    CloseHandle(h);
+    if (ok) out.assign(buf, len);
+    return ok;
+}
+
+static void ReportWindow(HWND hwnd)
+{
+    if (!hwnd || !g_fn) return;
+
+    DWORD pid = 0;
+    GetWindowThreadProcessId(hwnd, &pid);
+    if (pid == 0 || pid == GetCurrentProcessId() || pid == g_lastPid)
+        return;
+
+    std::wstring path;
+    if (!QueryImagePath(pid, path))
+    {
+        // Elevated or protected process: nothing to match against.
+        DebugLog_Write(L"[foreground] pid=%lu image query failed err=%lu", pid, GetLastError());
+        return;
+    }
+    g_lastPid = pid;
+    g_fn(path, g_ctx);
+}
+
+static void CALLBACK ForegroundEventProc(HWINEVENTHOOK, DWORD event, HWND hwnd,
+    LONG idObject, LONG, DWORD, DWORD)
+{
+    if (event != EVENT_SYSTEM_FOREGROUND || idObject != OBJID_WINDOW)
+        return;
+    ReportWindow(hwnd);
+}
+
+bool ForegroundWatch_Start(ForegroundChangedFn fn, void* ctx)
+{
+    ForegroundWatch_Stop();
+    if (!fn) return false;
+
+    g_fn = fn;
+    g_ctx = ctx;
+    g_lastPid = 0;
+    g_hook = SetWinEventHook(EVENT_SYSTEM_FOREGROUND, EVENT_SYSTEM_FOREGROUND, nullptr,
+        ForegroundEventProc, 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
+    if (!g_hook)
+    {
+        DebugLog_Write(L"[foreground] SetWinEventHook failed err=%lu", GetLastError());
+        g_fn = nullptr;
+        g_ctx = nullptr;
+        return false;
+    }
+
+    ReportWindow(GetForegroundWindow());
+    return true;
+}
+
+void ForegroundWatch_Stop()
+{
+    if (g_hook)
+    {
+        UnhookWinEvent(g_hook);
+        g_hook = nullptr;
+    }
+    g_fn = nullptr;
+    g_ctx = nullptr;
+    g_lastPid = 0;
+}
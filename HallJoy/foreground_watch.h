@@ -0,0 +1,13 @@
+// foreground_watch.h
+#pragma once
+#include <string>
+
+// Event-driven foreground tracking (SetWinEventHook, EVENT_SYSTEM_FOREGROUND),
+// no polling. The callback runs on the thread that called Start, from its
+// message loop, with the full image path of the new foreground process.
+// Focus moving to our own windows is not reported.
+using ForegroundChangedFn = void (*)(const std::wstring& exePath, void* ctx);
+
+// UI thread. Reports the current foreground window once right away.
+bool ForegroundWatch_Start(ForegroundChangedFn fn, void* ctx);
+void ForegroundWatch_Stop();
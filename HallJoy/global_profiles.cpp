@@ -8,6 +8,7 @@
 
 #include "global_profiles.h"
 #include "app_paths.h"
+#include "ini_doc.h"
 
 namespace fs = std::filesystem;
 
@@ -16,6 +17,8 @@ static constexpr const wchar_t* kMainSection = L"Main";
 static constexpr const wchar_t* kActiveProfileKey = L"ActiveGlobalProfile";
 
 static std::wstring g_activeProfile = kDefaultProfileName;
+static std::wstring g_startupProfile = kDefaultProfileName;
+static std::wstring g_markerWritten; // startup name last written to settings.ini; empty = unknown
 static bool g_dirty = false;
 
 static bool IEquals(const std::wstring& a, const std::wstring& b)
@@ -43,23 +46,50 @@ bool GlobalProfiles_IsDefault(const std::wstring& name)
     return name.empty() || IEquals(name, kDefaultProfileName);
 }
 
-void GlobalProfiles_InitFromSettingsIni(const wchar_t* settingsIniPath)
+void GlobalProfiles_InitFromSettingsIni(const IniDoc& settingsIni)
 {
     g_activeProfile = kDefaultProfileName;
     g_dirty = false;
-    if (!settingsIniPath) return;
 
-    wchar_t buf[260]{};
-    GetPrivateProfileStringW(kMainSection, kActiveProfileKey, kDefaultProfileName, buf, (DWORD)_countof(buf), settingsIniPath);
-    std::wstring n = GlobalProfiles_SanitizeName(buf);
+    std::wstring n = GlobalProfiles_SanitizeName(settingsIni.GetString(kMainSection, kActiveProfileKey, kDefaultProfileName));
     if (n.empty()) n = kDefaultProfileName;
     g_activeProfile = n;
+    g_startupProfile = n;
+    g_markerWritten = n;
 }
 
-void GlobalProfiles_SaveActiveToSettingsIni(const wchar_t* settingsIniPath)
+void GlobalProfiles_SaveStartupToSettingsIni(const wchar_t* settingsIniPath)
 {
     if (!settingsIniPath) return;
-    WritePrivateProfileStringW(kMainSection, kActiveProfileKey, g_activeProfile.c_str(), settingsIniPath);
+
+    // Read-modify-write keeps every other section; a missing file gets just this key.
+    IniDoc ini;
+    ini.Load(settingsIniPath);
+    ini.SetString(kMainSection, kActiveProfileKey, g_startupProfile.c_str());
+    ini.Save(settingsIniPath);
+    g_markerWritten = g_startupProfile;
+}
+
+const std::wstring& GlobalProfiles_GetStartupName()
+{
+    return g_startupProfile;
+}
+
+void GlobalProfiles_SetStartupName(const std::wstring& name)
+{
+    std::wstring n = GlobalProfiles_SanitizeName(name);
+    if (n.empty()) n = kDefaultProfileName;
+    g_startupProfile = n;
+}
+
+bool GlobalProfiles_IsMarkerCurrent()
+{
+    return !g_markerWritten.empty() && IEquals(g_markerWritten, g_startupProfile);
+}
+
+void GlobalProfiles_ResetMarkerCache()
+{
+    g_markerWritten.clear();
 }
 
 const std::wstring& GlobalProfiles_GetActiveName()
@@ -142,8 +172,13 @@ bool GlobalProfiles_Delete(const std::wstring& name)
 
     std::wstring s = GlobalProfiles_GetSettingsPath(name);
     std::wstring b = GlobalProfiles_GetBindingsPath(name);
-    std::error_code ec1, ec2;
+    std::error_code ec1, ec2, ec3;
     bool ok1 = fs::remove(fs::path(s), ec1) || !fs::exists(fs::path(s), ec1);
     bool ok2 = fs::remove(fs::path(b), ec2) || !fs::exists(fs::path(b), ec2);
-    return ok1 && ok2;
+
+    // Compiled profile cache ("<name>.settings.cache", see profile_cache.h): a
+    // profile created later under the same name must not pick it up.
+    fs::path cache = fs::path(s).replace_extension(L".cache");
+    bool ok3 = fs::remove(cache, ec3) || !fs::exists(cache, ec3);
+    return ok1 && ok2 && ok3;
 }
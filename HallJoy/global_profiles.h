@@ -2,10 +2,20 @@
 #include <string>
 #include <vector>
 
-// Active profile name is persisted in settings.ini [Main] ActiveGlobalProfile.
+class IniDoc;
+
+// settings.ini [Main] ActiveGlobalProfile holds the startup profile: the one the
+// user picked by hand, never one an auto-profile rule switched to.
 // "Default" means using base settings.ini + bindings.ini files.
-void GlobalProfiles_InitFromSettingsIni(const wchar_t* settingsIniPath);
-void GlobalProfiles_SaveActiveToSettingsIni(const wchar_t* settingsIniPath);
+void GlobalProfiles_InitFromSettingsIni(const IniDoc& settingsIni);
+void GlobalProfiles_SaveStartupToSettingsIni(const wchar_t* settingsIniPath);
+
+const std::wstring& GlobalProfiles_GetStartupName();
+void GlobalProfiles_SetStartupName(const std::wstring& name);
+// True if settings.ini is known to hold the current startup name.
+bool GlobalProfiles_IsMarkerCurrent();
+// Call when a full settings.ini save carries the marker (it lands later).
+void GlobalProfiles_ResetMarkerCache();
 
 const std::wstring& GlobalProfiles_GetActiveName();
 void GlobalProfiles_SetActiveName(const std::wstring& name);
@@ -0,0 +1,389 @@
+// ini_doc.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <cstddef>
+#include <cwchar>
+#include <cwctype>
+#include <string>
+#include <vector>
+
+#include "ini_doc.h"
+#include "ini_util.h"
+
+static constexpr DWORD kMaxIniBytes = 64u * 1024u * 1024u;
+
+static std::wstring Fold(std::wstring_view s)
+{
+    std::wstring out(s);
+    for (wchar_t& c : out)
+        c = (wchar_t)std::towlower((wint_t)c);
+    return out;
+}
+
+static bool IsBlank(wchar_t c)
+{
+    return c == L' ' || c == L'\t' || c == L'\r' || c == L'\n' || c == L'\f' || c == L'\v';
+}
+
+static std::wstring_view Trim(std::wstring_view s)
+{
+    while (!s.empty() && IsBlank(s.front())) s.remove_prefix(1);
+    while (!s.empty() && IsBlank(s.back())) s.remove_suffix(1);
+    return s;
+}
+
+static std::wstring DecodeBytes(const std::vector<char>& bytes)
+{
+    const size_t n = bytes.size();
+    const unsigned char* b = (const unsigned char*)bytes.data();
+
+    if (n >= 2 && b[0] == 0xFF && b[1] == 0xFE)
+    {
+        std::wstring out((n - 2) / 2, L'\0');
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = (wchar_t)(b[2 + i * 2] | (b[3 + i * 2] << 8));
+        return out;
+    }
+
+    size_t skip = 0;
+    UINT cp = CP_UTF8;
+    DWORD flags = MB_ERR_INVALID_CHARS;
+    if (n >= 3 && b[0] == 0xEF && b[1] == 0xBB && b[2] == 0xBF)
+        skip = 3;
+
+    const char* src = bytes.data() + skip;
+    int srcLen = (int)(n - skip);
+    if (srcLen <= 0) return {};
+
+    int wlen = MultiByteToWideChar(cp, flags, src, srcLen, nullptr, 0);
+    if (wlen <= 0)
+    {
+        // Not UTF-8: the Win32 INI API reads BOM-less files in the ANSI code page.
+        cp = CP_ACP;
+        flags = 0;
+        wlen = MultiByteToWideChar(cp, flags, src, srcLen, nullptr, 0);
+        if (wlen <= 0) return {};
+    }
+
+    std::wstring out((size_t)wlen, L'\0');
+    MultiByteToWideChar(cp, flags, src, srcLen, out.data(), wlen);
+    return out;
+}
+
+static std::vector<char> EncodeText(const std::wstring& text)
+{
+    bool ascii = true;
+    for (wchar_t c : text)
+    {
+        if ((unsigned)c >= 0x80) { ascii = false; break; }
+    }
+
+    std::vector<char> out;
+    if (ascii)
+    {
+        out.reserve(text.size());
+        for (wchar_t c : text) out.push_back((char)c);
+        return out;
+    }
+
+    out.reserve(2 + text.size() * 2);
+    out.push_back((char)0xFF);
+    out.push_back((char)0xFE);
+    for (wchar_t c : text)
+    {
+        out.push_back((char)(c & 0xFF));
+        out.push_back((char)((c >> 8) & 0xFF));
+    }
+    return out;
+}
+
+bool IniDoc::Load(const wchar_t* path)
+{
+    Clear();
+    if (!path || !path[0]) return false;
+
+    HANDLE h = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (h == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(h, &size) || size.QuadPart < 0 || size.QuadPart > (LONGLONG)kMaxIniBytes)
+    {
+        CloseHandle(h);
+        return false;
+    }
+
+    std::vector<char> bytes((size_t)size.QuadPart);
+    DWORD got = 0;
+    BOOL ok = bytes.empty() ? TRUE : ReadFile(h, bytes.data(), (DWORD)bytes.size(), &got, nullptr);
+    CloseHandle(h);
+    if (!ok) return false;
+    bytes.resize(got);
+
+    std::wstring text = DecodeBytes(bytes);
+    Parse(text);
+    return true;
+}
+
+bool IniDoc::Save(const wchar_t* path) const
+{
+    if (!path || !path[0]) return false;
+
+    std::wstring tmp = std::wstring(path) + L".tmp";
+    std::vector<char> bytes = EncodeText(Serialize());
+
+    HANDLE h = CreateFileW(tmp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (h == INVALID_HANDLE_VALUE) return false;
+
+    DWORD written = 0;
+    BOOL ok = bytes.empty() ? TRUE : WriteFile(h, bytes.data(), (DWORD)bytes.size(), &written, nullptr);
+    ok = ok && (written == (DWORD)bytes.size());
+    ok = ok && FlushFileBuffers(h);
+    CloseHandle(h);
+
+    if (!ok)
+    {
+        DeleteFileW(tmp.c_str());
+        return false;
+    }
+    return IniUtil_AtomicReplace(tmp.c_str(), path);
+}
+
+void IniDoc::Clear()
+{
+    m_sections.clear();
+    m_sectionIndex.clear();
+}
+
+void IniDoc::Parse(std::wstring_view text)
+{
+    Clear();
+
+    SectionData* cur = nullptr;
+    bool skipSection = false; // duplicate section header: GetPrivateProfile* only sees the first
+
+    size_t pos = 0;
+    while (pos <= text.size())
+    {
+        size_t eol = text.find(L'\n', pos);
+        if (eol == std::wstring_view::npos) eol = text.size();
+        std::wstring_view line = Trim(text.substr(pos, eol - pos));
+        pos = eol + 1;
+
+        if (line.empty() || line.front() == L';')
+            continue;
+
+        if (line.front() == L'[')
+        {
+            size_t close = line.find(L']');
+            std::wstring_view name = Trim(line.substr(1, (close == std::wstring_view::npos) ? std::wstring_view::npos : close - 1));
+            std::wstring folded = Fold(name);
+            if (m_sectionIndex.count(folded))
+            {
+                cur = nullptr;
+                skipSection = true;
+                continue;
+            }
+            m_sectionIndex.emplace(std::move(folded), m_sections.size());
+            m_sections.push_back(SectionData{});
+            m_sections.back().name.assign(name);
+            cur = &m_sections.back();
+            skipSection = false;
+            continue;
+        }
+
+        if (!cur || skipSection) continue;
+
+        size_t eq = line.find(L'=');
+        if (eq == std::wstring_view::npos) continue;
+
+        std::wstring_view key = Trim(line.substr(0, eq));
+        std::wstring_view value = Trim(line.substr(eq + 1));
+        if (value.size() >= 2 &&
+            (value.front() == L'"' || value.front() == L'\'') && value.back() == value.front())
+        {
+            value = value.substr(1, value.size() - 2);
+        }
+
+        std::wstring folded = Fold(key);
+        if (cur->index.count(folded)) continue;
+        cur->index.emplace(std::move(folded), cur->entries.size());
+        cur->entries.push_back(Entry{ std::wstring(key), std::wstring(value) });
+    }
+}
+
+std::wstring IniDoc::Serialize() const
+{
+    size_t cap = 0;
+    for (const SectionData& s : m_sections)
+    {
+        if (s.removed) continue;
+        cap += s.name.size() + 6;
+        for (const Entry& e : s.entries) cap += e.key.size() + e.value.size() + 3;
+    }
+
+    std::wstring out;
+    out.reserve(cap);
+    bool first = true;
+    for (const SectionData& s : m_sections)
+    {
+        if (s.removed) continue;
+        if (!first) out += L"\r\n";
+        first = false;
+
+        out += L'[';
+        out += s.name;
+        out += L"]\r\n";
+        for (const Entry& e : s.entries)
+        {
+            out += e.key;
+            out += L'=';
+            out += e.value;
+            out += L"\r\n";
+        }
+    }
+    return out;
+}
+
+const IniDoc::SectionData* IniDoc::FindSection(const wchar_t* section) const
+{
+    if (!section) return nullptr;
+    auto it = m_sectionIndex.find(Fold(section));
+    return (it == m_sectionIndex.end()) ? nullptr : &m_sections[it->second];
+}
+
+IniDoc::SectionData& IniDoc::EnsureSection(const wchar_t* section)
+{
+    std::wstring folded = Fold(section);
+    auto it = m_sectionIndex.find(folded);
+    if (it != m_sectionIndex.end()) return m_sections[it->second];
+
+    m_sectionIndex.emplace(std::move(folded), m_sections.size());
+    m_sections.push_back(SectionData{});
+    m_sections.back().name = section;
+    return m_sections.back();
+}
+
+void IniDoc::Reindex(SectionData& s)
+{
+    s.index.clear();
+    for (size_t i = 0; i < s.entries.size(); ++i)
+        s.index.emplace(Fold(s.entries[i].key), i);
+}
+
+bool IniDoc::HasSection(const wchar_t* section) const
+{
+    return FindSection(section) != nullptr;
+}
+
+bool IniDoc::HasKey(const wchar_t* section, const wchar_t* key) const
+{
+    return Find(section, key) != nullptr;
+}
+
+const std::wstring* IniDoc::Find(const wchar_t* section, const wchar_t* key) const
+{
+    const SectionData* s = FindSection(section);
+    if (!s || !key) return nullptr;
+    auto it = s->index.find(Fold(key));
+    return (it == s->index.end()) ? nullptr : &s->entries[it->second].value;
+}
+
+const std::vector<IniDoc::Entry>* IniDoc::Section(const wchar_t* section) const
+{
+    const SectionData* s = FindSection(section);
+    return s ? &s->entries : nullptr;
+}
+
+std::wstring IniDoc::GetString(const wchar_t* section, const wchar_t* key, const wchar_t* def) const
+{
+    const std::wstring* v = Find(section, key);
+    if (v) return *v;
+    return def ? std::wstring(def) : std::wstring();
+}
+
+int IniDoc::GetInt(const wchar_t* section, const wchar_t* key, int def) const
+{
+    const std::wstring* v = Find(section, key);
+    if (!v || v->empty()) return def;
+
+    const wchar_t* p = v->c_str();
+    bool neg = false;
+    if (*p == L'-') { neg = true; ++p; }
+    else if (*p == L'+') { ++p; }
+
+    int base = 10;
+    if (p[0] == L'0' && (p[1] == L'x' || p[1] == L'X'))
+    {
+        base = 16;
+        p += 2;
+    }
+
+    uint32_t acc = 0;
+    for (; *p; ++p)
+    {
+        unsigned d;
+        if (*p >= L'0' && *p <= L'9') d = (unsigned)(*p - L'0');
+        else if (base == 16 && *p >= L'a' && *p <= L'f') d = 10u + (unsigned)(*p - L'a');
+        else if (base == 16 && *p >= L'A' && *p <= L'F') d = 10u + (unsigned)(*p - L'A');
+        else break;
+        acc = acc * (uint32_t)base + d;
+    }
+    return neg ? -(int)acc : (int)acc;
+}
+
+void IniDoc::SetString(const wchar_t* section, const wchar_t* key, const wchar_t* value)
+{
+    if (!section || !key) return;
+    SectionData& s = EnsureSection(section);
+    std::wstring folded = Fold(key);
+    auto it = s.index.find(folded);
+    if (it != s.index.end())
+    {
+        s.entries[it->second].value = value ? value : L"";
+        return;
+    }
+    s.index.emplace(std::move(folded), s.entries.size());
+    s.entries.push_back(Entry{ key, value ? value : L"" });
+}
+
+void IniDoc::SetInt(const wchar_t* section, const wchar_t* key, int value)
+{
+    wchar_t buf[32]{};
+    swprintf_s(buf, L"%d", value);
+    SetString(section, key, buf);
+}
+
+void IniDoc::SetUInt(const wchar_t* section, const wchar_t* key, uint32_t value)
+{
+    wchar_t buf[32]{};
+    swprintf_s(buf, L"%u", (unsigned)value);
+    SetString(section, key, buf);
+}
+
+void IniDoc::RemoveKey(const wchar_t* section, const wchar_t* key)
+{
+    if (!section || !key) return;
+    auto sit = m_sectionIndex.find(Fold(section));
+    if (sit == m_sectionIndex.end()) return;
+
+    SectionData& s = m_sections[sit->second];
+    auto it = s.index.find(Fold(key));
+    if (it == s.index.end()) return;
+    s.entries.erase(s.entries.begin() + (ptrdiff_t)it->second);
+    Reindex(s);
+}
+
+void IniDoc::RemoveSection(const wchar_t* section)
+{
+    if (!section) return;
+    auto sit = m_sectionIndex.find(Fold(section));
+    if (sit == m_sectionIndex.end()) return;
+
+    SectionData& s = m_sections[sit->second];
+    s.removed = true;
+    s.entries.clear();
+    s.index.clear();
+    m_sectionIndex.erase(sit);
+}
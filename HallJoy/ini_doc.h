@@ -0,0 +1,75 @@
+// ini_doc.h
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// In-memory INI document: the file is parsed once into indexed sections and
+// written back in one pass. Lookups follow GetPrivateProfile* rules so existing
+// files read the same: section/key names are case-insensitive, the first of
+// duplicate sections/keys wins, whitespace around names and values is trimmed,
+// a value wrapped in matching quotes is unquoted, ';' lines are comments.
+//
+// Files are decoded from UTF-16LE (BOM), UTF-8 (BOM or valid) or the ANSI code
+// page. Save writes plain ASCII when possible and UTF-16LE with BOM otherwise,
+// which both the Win32 INI API and older builds read back.
+//
+// Not thread-safe; callers own their document.
+class IniDoc
+{
+public:
+    struct Entry
+    {
+        std::wstring key;
+        std::wstring value;
+    };
+
+    // Replaces the contents with the parsed file. Returns false (document left
+    // empty) if the file is missing or unreadable.
+    bool Load(const wchar_t* path);
+
+    // Serializes and atomically replaces `path` (via "<path>.tmp").
+    bool Save(const wchar_t* path) const;
+
+    void Parse(std::wstring_view text);
+    std::wstring Serialize() const;
+    void Clear();
+
+    bool HasSection(const wchar_t* section) const;
+    bool HasKey(const wchar_t* section, const wchar_t* key) const;
+
+    // nullptr if the section or key is missing.
+    const std::wstring* Find(const wchar_t* section, const wchar_t* key) const;
+    // Entries in file order; nullptr if the section is missing.
+    const std::vector<Entry>* Section(const wchar_t* section) const;
+
+    std::wstring GetString(const wchar_t* section, const wchar_t* key, const wchar_t* def) const;
+    // Like GetPrivateProfileIntW: decimal or 0x hex, leading digits only,
+    // non-numeric text reads as 0. Missing or empty values return def.
+    int GetInt(const wchar_t* section, const wchar_t* key, int def) const;
+
+    void SetString(const wchar_t* section, const wchar_t* key, const wchar_t* value);
+    void SetInt(const wchar_t* section, const wchar_t* key, int value);
+    void SetUInt(const wchar_t* section, const wchar_t* key, uint32_t value);
+    void RemoveKey(const wchar_t* section, const wchar_t* key);
+    // Drops the section and all its keys.
+    void RemoveSection(const wchar_t* section);
+
+private:
+    struct SectionData
+    {
+        std::wstring name;
+        std::vector<Entry> entries;
+        std::unordered_map<std::wstring, size_t> index; // folded key -> entries[]
+        bool removed = false;
+    };
+
+    const SectionData* FindSection(const wchar_t* section) const;
+    SectionData& EnsureSection(const wchar_t* section);
+    static void Reindex(SectionData& s);
+
+    std::vector<SectionData> m_sections;
+    std::unordered_map<std::wstring, size_t> m_sectionIndex; // folded name -> m_sections[]
+};
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <shared_mutex>
 #include <mutex>
 #include <unordered_map>
@@ -19,30 +20,71 @@
 static std::array<KeyDeadzone, 256> g_fastData{};
 static std::shared_mutex g_fastMutex;
 
-struct FastSnapshot
+// One cache line per HID: full-precision float bits under a single sequence
+// counter, so a load touches one line and matches the UI's KeyDeadzone exactly
+// (KeyDigital is packed, see PackDigital).
+enum FastRecordFlag : uint32_t
+{
+    FastRecordFlag_UseUnique = 1u << 0,
+    FastRecordFlag_Invert = 1u << 1,
+    FastRecordFlag_CurveSmooth = 1u << 2, // curveMode == 0
+    FastRecordFlag_RapidTrigger = 1u << 3,
+    FastRecordFlag_RapidTriggerRaw = 1u << 4,
+};
+
+static constexpr uint32_t FloatBits(float v) { return std::bit_cast<uint32_t>(v); }
+static float BitsFloat(uint32_t b) { return std::bit_cast<float>(b); }
+
+// KeyDigital thresholds are milli-quantized by Normalize, so three of them fit
+// one word (10 bits each: rtDelta | press << 10 | release << 20) without loss.
+static constexpr uint32_t MilliOf(float v) { return (uint32_t)(v * 1000.0f + 0.5f) & 0x3FFu; }
+static constexpr uint32_t PackDigital(const KeyDigital& d)
+{
+    return MilliOf(d.rtDelta) | (MilliOf(d.pressPoint) << 10) | (MilliOf(d.releasePoint) << 20);
+}
+static void UnpackDigital(uint32_t w, KeyDigital& d)
+{
+    d.rtDelta = (float)(w & 0x3FFu) / 1000.0f;
+    d.pressPoint = (float)((w >> 10) & 0x3FFu) / 1000.0f;
+    d.releasePoint = (float)((w >> 20) & 0x3FFu) / 1000.0f;
+}
+
+struct alignas(64) FastRecord
 {
     std::atomic<uint32_t> seq{ 0 };
-    std::atomic<uint8_t> useUnique{ 0 };
-    std::atomic<uint8_t> invert{ 0 };
-    std::atomic<uint8_t> curveMode{ 1 };
-    std::atomic<int16_t> lowM{ 80 };
-    std::atomic<int16_t> highM{ 900 };
-    std::atomic<int16_t> antiDeadzoneM{ 0 };
-    std::atomic<int16_t> outputCapM{ 1000 };
-    std::atomic<int16_t> cp1xM{ 380 };
-    std::atomic<int16_t> cp1yM{ 330 };
-    std::atomic<int16_t> cp2xM{ 680 };
-    std::atomic<int16_t> cp2yM{ 660 };
-    std::atomic<int16_t> cp1wM{ 1000 };
-    std::atomic<int16_t> cp2wM{ 1000 };
+    std::atomic<uint32_t> flags{ 0 };
+    std::atomic<uint32_t> low{ FloatBits(0.08f) };
+    std::atomic<uint32_t> high{ FloatBits(0.90f) };
+    std::atomic<uint32_t> antiDeadzone{ FloatBits(0.0f) };
+    std::atomic<uint32_t> outputCap{ FloatBits(1.0f) };
+    std::atomic<uint32_t> cp1x{ FloatBits(0.38f) };
+    std::atomic<uint32_t> cp1y{ FloatBits(0.33f) };
+    std::atomic<uint32_t> cp2x{ FloatBits(0.68f) };
+    std::atomic<uint32_t> cp2y{ FloatBits(0.66f) };
+    std::atomic<uint32_t> cp1w{ FloatBits(1.0f) };
+    std::atomic<uint32_t> cp2w{ FloatBits(1.0f) };
+    std::atomic<uint32_t> digital{ PackDigital(KeyDigital{}) };
 };
+static_assert(sizeof(FastRecord) == 64, "FastRecord must stay one cache line");
 
-static std::array<FastSnapshot, 256> g_fastSnapshot{};
+static std::array<FastRecord, 256> g_fastRecords{};
+// Reader retries in FastRecordLoad (odd seq or seq changed mid-read).
+static std::atomic<uint64_t> g_fastSnapshotRetries{ 0 };
+// Bumped after every store; lets readers keep derived data until it changes.
+static std::atomic<uint64_t> g_generation{ 1 };
 
-// Slow path: HID >= 256
+// HID >= 256: g_mapData is the authoritative store (enumeration, overflow).
 static std::unordered_map<uint16_t, KeyDeadzone> g_mapData;
 static std::shared_mutex g_mapMutex;
 
+// Lock-free read index for HID >= 256: open addressing with linear probing,
+// slots are only claimed (never freed) until ClearAll. Writers hold g_mapMutex.
+// Keys that don't fit set g_extOverflow and are served from g_mapData.
+static constexpr size_t kExtSlots = 64; // power of two
+static std::array<std::atomic<uint16_t>, kExtSlots> g_extHid{};
+static std::array<FastRecord, kExtSlots> g_extRecords{};
+static std::atomic<bool> g_extOverflow{ false };
+
 static inline void CpuRelax()
 {
 #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
@@ -52,77 +94,143 @@ static inline void CpuRelax()
 #endif
 }
 
-static int16_t ToMilli(float v)
-{
-    int m = (int)lroundf(std::clamp(v, 0.0f, 1.0f) * 1000.0f);
-    return (int16_t)std::clamp(m, 0, 1000);
-}
-
-static float FromMilli(int16_t m)
+static void FastRecordStore(FastRecord* r, const KeyDeadzone& s)
 {
-    return (float)std::clamp((int)m, 0, 1000) / 1000.0f;
+    FastRecord& rec = *r;
+    rec.seq.fetch_add(1u, std::memory_order_acq_rel); // odd => writer in progress
+
+    uint32_t flags = 0;
+    if (s.useUnique) flags |= FastRecordFlag_UseUnique;
+    if (s.invert) flags |= FastRecordFlag_Invert;
+    if (s.curveMode == 0) flags |= FastRecordFlag_CurveSmooth;
+    if (s.digital.rapidTrigger) flags |= FastRecordFlag_RapidTrigger;
+    if (s.digital.rtRaw) flags |= FastRecordFlag_RapidTriggerRaw;
+    rec.flags.store(flags, std::memory_order_relaxed);
+
+    rec.low.store(FloatBits(s.low), std::memory_order_relaxed);
+    rec.high.store(FloatBits(s.high), std::memory_order_relaxed);
+    rec.antiDeadzone.store(FloatBits(s.antiDeadzone), std::memory_order_relaxed);
+    rec.outputCap.store(FloatBits(s.outputCap), std::memory_order_relaxed);
+    rec.cp1x.store(FloatBits(s.cp1_x), std::memory_order_relaxed);
+    rec.cp1y.store(FloatBits(s.cp1_y), std::memory_order_relaxed);
+    rec.cp2x.store(FloatBits(s.cp2_x), std::memory_order_relaxed);
+    rec.cp2y.store(FloatBits(s.cp2_y), std::memory_order_relaxed);
+    rec.cp1w.store(FloatBits(s.cp1_w), std::memory_order_relaxed);
+    rec.cp2w.store(FloatBits(s.cp2_w), std::memory_order_relaxed);
+    rec.digital.store(PackDigital(s.digital), std::memory_order_relaxed);
+
+    rec.seq.fetch_add(1u, std::memory_order_release); // even => stable
+    g_generation.fetch_add(1u, std::memory_order_release);
 }
 
-static void FastSnapshotStore(uint16_t hid, const KeyDeadzone& s)
-{
-    FastSnapshot& snap = g_fastSnapshot[hid];
-    snap.seq.fetch_add(1u, std::memory_order_acq_rel); // odd => writer in progress
-
-    snap.useUnique.store(s.useUnique ? 1u : 0u, std::memory_order_relaxed);
-    snap.invert.store(s.invert ? 1u : 0u, std::memory_order_relaxed);
-    snap.curveMode.store((s.curveMode == 0) ? 0u : 1u, std::memory_order_relaxed);
-
-    snap.lowM.store(ToMilli(s.low), std::memory_order_relaxed);
-    snap.highM.store(ToMilli(s.high), std::memory_order_relaxed);
-    snap.antiDeadzoneM.store(ToMilli(s.antiDeadzone), std::memory_order_relaxed);
-    snap.outputCapM.store(ToMilli(s.outputCap), std::memory_order_relaxed);
-    snap.cp1xM.store(ToMilli(s.cp1_x), std::memory_order_relaxed);
-    snap.cp1yM.store(ToMilli(s.cp1_y), std::memory_order_relaxed);
-    snap.cp2xM.store(ToMilli(s.cp2_x), std::memory_order_relaxed);
-    snap.cp2yM.store(ToMilli(s.cp2_y), std::memory_order_relaxed);
-    snap.cp1wM.store(ToMilli(s.cp1_w), std::memory_order_relaxed);
-    snap.cp2wM.store(ToMilli(s.cp2_w), std::memory_order_relaxed);
-
-    snap.seq.fetch_add(1u, std::memory_order_release); // even => stable
-}
-
-static KeyDeadzone FastSnapshotLoad(uint16_t hid)
+static KeyDeadzone FastRecordLoad(const FastRecord* r)
 {
     KeyDeadzone out{};
-    FastSnapshot& snap = g_fastSnapshot[hid];
+    const FastRecord& rec = *r;
 
     for (;;)
     {
-        uint32_t s1 = snap.seq.load(std::memory_order_acquire);
+        uint32_t s1 = rec.seq.load(std::memory_order_acquire);
         if (s1 & 1u)
         {
+            g_fastSnapshotRetries.fetch_add(1, std::memory_order_relaxed);
             CpuRelax();
             continue;
         }
 
-        out.useUnique = snap.useUnique.load(std::memory_order_relaxed) != 0;
-        out.invert = snap.invert.load(std::memory_order_relaxed) != 0;
-        out.curveMode = (uint8_t)(snap.curveMode.load(std::memory_order_relaxed) == 0 ? 0 : 1);
-
-        out.low = FromMilli(snap.lowM.load(std::memory_order_relaxed));
-        out.high = FromMilli(snap.highM.load(std::memory_order_relaxed));
-        out.antiDeadzone = FromMilli(snap.antiDeadzoneM.load(std::memory_order_relaxed));
-        out.outputCap = FromMilli(snap.outputCapM.load(std::memory_order_relaxed));
-        out.cp1_x = FromMilli(snap.cp1xM.load(std::memory_order_relaxed));
-        out.cp1_y = FromMilli(snap.cp1yM.load(std::memory_order_relaxed));
-        out.cp2_x = FromMilli(snap.cp2xM.load(std::memory_order_relaxed));
-        out.cp2_y = FromMilli(snap.cp2yM.load(std::memory_order_relaxed));
-        out.cp1_w = FromMilli(snap.cp1wM.load(std::memory_order_relaxed));
-        out.cp2_w = FromMilli(snap.cp2wM.load(std::memory_order_relaxed));
-
-        uint32_t s2 = snap.seq.load(std::memory_order_acquire);
-        if (s1 == s2)
+        uint32_t flags = rec.flags.load(std::memory_order_relaxed);
+        out.useUnique = (flags & FastRecordFlag_UseUnique) != 0;
+        out.invert = (flags & FastRecordFlag_Invert) != 0;
+        out.curveMode = (flags & FastRecordFlag_CurveSmooth) ? 0 : 1;
+        out.digital.rapidTrigger = (flags & FastRecordFlag_RapidTrigger) != 0;
+        out.digital.rtRaw = (flags & FastRecordFlag_RapidTriggerRaw) != 0;
+
+        out.low = BitsFloat(rec.low.load(std::memory_order_relaxed));
+        out.high = BitsFloat(rec.high.load(std::memory_order_relaxed));
+        out.antiDeadzone = BitsFloat(rec.antiDeadzone.load(std::memory_order_relaxed));
+        out.outputCap = BitsFloat(rec.outputCap.load(std::memory_order_relaxed));
+        out.cp1_x = BitsFloat(rec.cp1x.load(std::memory_order_relaxed));
+        out.cp1_y = BitsFloat(rec.cp1y.load(std::memory_order_relaxed));
+        out.cp2_x = BitsFloat(rec.cp2x.load(std::memory_order_relaxed));
+        out.cp2_y = BitsFloat(rec.cp2y.load(std::memory_order_relaxed));
+        out.cp1_w = BitsFloat(rec.cp1w.load(std::memory_order_relaxed));
+        out.cp2_w = BitsFloat(rec.cp2w.load(std::memory_order_relaxed));
+        UnpackDigital(rec.digital.load(std::memory_order_relaxed), out.digital);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (rec.seq.load(std::memory_order_relaxed) == s1)
             return out;
 
+        g_fastSnapshotRetries.fetch_add(1, std::memory_order_relaxed);
         CpuRelax();
     }
 }
 
+static size_t ExtSlotStart(uint16_t hid)
+{
+    return ((size_t)hid * 0x9E37u) & (kExtSlots - 1);
+}
+
+// Returns slot index or -1. Any thread, lock-free.
+static int ExtFindSlot(uint16_t hid)
+{
+    size_t i = ExtSlotStart(hid);
+    for (size_t n = 0; n < kExtSlots; ++n, i = (i + 1) & (kExtSlots - 1))
+    {
+        uint16_t h = g_extHid[i].load(std::memory_order_acquire);
+        if (h == hid) return (int)i;
+        if (h == 0) return -1;
+    }
+    return -1;
+}
+
+// Writer only (g_mapMutex held exclusively).
+static bool ExtStore(uint16_t hid, const KeyDeadzone& s)
+{
+    size_t i = ExtSlotStart(hid);
+    for (size_t n = 0; n < kExtSlots; ++n, i = (i + 1) & (kExtSlots - 1))
+    {
+        uint16_t h = g_extHid[i].load(std::memory_order_relaxed);
+        if (h == hid)
+        {
+            FastRecordStore(&g_extRecords[i], s);
+            return true;
+        }
+        if (h == 0)
+        {
+            // Fill the record before publishing the key so readers never see a stale one.
+            FastRecordStore(&g_extRecords[i], s);
+            g_extHid[i].store(hid, std::memory_order_release);
+            return true;
+        }
+    }
+    g_extOverflow.store(true, std::memory_order_release);
+    return false;
+}
+
+// Lock-free unless the index overflowed and hid isn't in it.
+static bool ExtLoad(uint16_t hid, KeyDeadzone& out)
+{
+    for (;;)
+    {
+        int slot = ExtFindSlot(hid);
+        if (slot < 0) break;
+        out = FastRecordLoad(&g_extRecords[(size_t)slot]);
+        // Slot recycled by ClearAll + Set while we were reading: look it up again.
+        if (g_extHid[(size_t)slot].load(std::memory_order_acquire) == hid)
+            return true;
+    }
+
+    if (!g_extOverflow.load(std::memory_order_acquire))
+        return false;
+
+    std::shared_lock lock(g_mapMutex);
+    auto it = g_mapData.find(hid);
+    if (it == g_mapData.end()) return false;
+    out = it->second;
+    return true;
+}
+
 static KeyDeadzone Normalize(KeyDeadzone s)
 {
     // Normalize curveMode: only 0 or 1 for now
@@ -174,6 +282,11 @@ static KeyDeadzone Normalize(KeyDeadzone s)
 
     // We do NOT force cp y into [antiDeadzone..outputCap] (max flexibility).
 
+    auto milli = [](float v) { return std::round(v * 1000.0f) / 1000.0f; };
+    s.digital.rtDelta = milli(std::clamp(s.digital.rtDelta, 0.01f, 0.5f));
+    s.digital.pressPoint = milli(std::clamp(s.digital.pressPoint, 0.02f, 0.98f));
+    s.digital.releasePoint = milli(std::clamp(s.digital.releasePoint, 0.01f, s.digital.pressPoint));
+
     return s;
 }
 
@@ -186,14 +299,16 @@ void KeySettings_Set(uint16_t hid, const KeyDeadzone& in)
     {
         std::unique_lock lock(g_fastMutex);
         g_fastData[hid] = norm;
-        FastSnapshotStore(hid, norm);
+        FastRecordStore(&g_fastRecords[hid], norm);
         return;
     }
 
     {
         std::unique_lock lock(g_mapMutex);
         g_mapData[hid] = norm;
+        ExtStore(hid, norm);
     }
+    g_generation.fetch_add(1u, std::memory_order_release);
 }
 
 KeyDeadzone KeySettings_Get(uint16_t hid)
@@ -203,15 +318,12 @@ KeyDeadzone KeySettings_Get(uint16_t hid)
 
     if (hid < 256)
     {
-        return FastSnapshotLoad(hid);
+        return FastRecordLoad(&g_fastRecords[hid]);
     }
 
-    {
-        std::shared_lock lock(g_mapMutex);
-        auto it = g_mapData.find(hid);
-        if (it == g_mapData.end()) return def;
-        return it->second;
-    }
+    KeyDeadzone out{};
+    if (!ExtLoad(hid, out)) return def;
+    return out;
 }
 
 bool KeySettings_GetUseUnique(uint16_t hid)
@@ -220,16 +332,18 @@ bool KeySettings_GetUseUnique(uint16_t hid)
 
     if (hid < 256)
     {
-        return g_fastSnapshot[hid].useUnique.load(std::memory_order_acquire) != 0;
+        return (g_fastRecords[hid].flags.load(std::memory_order_acquire) & FastRecordFlag_UseUnique) != 0;
     }
 
-    // HID >= 256: slow path
-    {
-        std::shared_lock lock(g_mapMutex);
-        auto it = g_mapData.find(hid);
-        if (it == g_mapData.end()) return false;
-        return it->second.useUnique;
-    }
+    // HID >= 256: extended index
+    int slot = ExtFindSlot(hid);
+    if (slot >= 0)
+        return (g_extRecords[(size_t)slot].flags.load(std::memory_order_acquire) & FastRecordFlag_UseUnique) != 0;
+    if (!g_extOverflow.load(std::memory_order_acquire))
+        return false;
+
+    KeyDeadzone d{};
+    return ExtLoad(hid, d) && d.useUnique;
 }
 
 void KeySettings_SetUseUnique(uint16_t hid, bool on)
@@ -274,13 +388,17 @@ void KeySettings_ClearAll()
         for (uint16_t hid = 0; hid < 256; ++hid)
         {
             g_fastData[hid] = KeyDeadzone{};
-            FastSnapshotStore(hid, g_fastData[hid]);
+            FastRecordStore(&g_fastRecords[hid], g_fastData[hid]);
         }
     }
     {
         std::unique_lock lock(g_mapMutex);
         g_mapData.clear();
+        for (auto& h : g_extHid)
+            h.store(0, std::memory_order_release);
+        g_extOverflow.store(false, std::memory_order_release);
     }
+    g_generation.fetch_add(1u, std::memory_order_release);
 }
 
 static bool NearlyEq(float a, float b, float eps = 1e-4f)
@@ -310,6 +428,12 @@ static bool IsDefaultLike(const KeyDeadzone& a)
     if (!NearlyEq(a.cp1_w, def.cp1_w)) return false;
     if (!NearlyEq(a.cp2_w, def.cp2_w)) return false;
 
+    if (a.digital.rapidTrigger != def.digital.rapidTrigger) return false;
+    if (a.digital.rtRaw != def.digital.rtRaw) return false;
+    if (!NearlyEq(a.digital.rtDelta, def.digital.rtDelta)) return false;
+    if (!NearlyEq(a.digital.pressPoint, def.digital.pressPoint)) return false;
+    if (!NearlyEq(a.digital.releasePoint, def.digital.releasePoint)) return false;
+
     return true;
 }
 
@@ -339,3 +463,31 @@ void KeySettings_Enumerate(std::vector<std::pair<uint16_t, KeyDeadzone>>& out)
             out.emplace_back(hid, d);
     }
 }
+
+uint64_t KeySettings_GetSnapshotRetryCount()
+{
+    return g_fastSnapshotRetries.load(std::memory_order_relaxed);
+}
+
+uint64_t KeySettings_GetGeneration()
+{
+    return g_generation.load(std::memory_order_acquire);
+}
+
+void KeySettings_CopyFast(KeySettingsFastCopy* out)
+{
+    if (!out) return;
+    out->generation = g_generation.load(std::memory_order_acquire);
+    out->uniqueMask.fill(0);
+    for (uint16_t hid = 1; hid < 256; ++hid)
+    {
+        // Cheap skip for keys without an override; only those pay for a full record read.
+        if ((g_fastRecords[hid].flags.load(std::memory_order_acquire) & FastRecordFlag_UseUnique) == 0)
+            continue;
+        KeyDeadzone d = FastRecordLoad(&g_fastRecords[hid]);
+        if (!d.useUnique)
+            continue;
+        out->keys[hid] = d;
+        out->uniqueMask[hid >> 6] |= (1ull << (hid & 63));
+    }
+}
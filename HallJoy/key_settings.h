@@ -1,9 +1,28 @@
 // key_settings.h
 #pragma once
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <utility>
 
+// Digital (button) output of a key. Independent of useUnique: it applies
+// whenever the key is bound to a gamepad button, and the curve editor leaves it alone.
+// Values are 0..1 and kept at 1/1000 resolution (the INI unit).
+struct KeyDigital
+{
+    // Actuation with hysteresis: the button goes down at >= pressPoint and
+    // only comes back up below releasePoint (<= pressPoint).
+    float pressPoint = 0.10f;
+    float releasePoint = 0.08f;
+
+    // Rapid trigger: after the first actuation the key flips state whenever its
+    // travel reverses by rtDelta (0..1), instead of re-crossing a fixed point.
+    // pressPoint / releasePoint still bound the first press and full release.
+    bool rapidTrigger = false;
+    bool rtRaw = false;     // track the raw sensor value instead of the curve output
+    float rtDelta = 0.05f;
+};
+
 struct KeyDeadzone
 {
     bool useUnique = false;
@@ -39,6 +58,8 @@ struct KeyDeadzone
     // 0 = Smooth (Bezier)
     // 1 = Linear (Segments)
     uint8_t curveMode = 1;
+
+    KeyDigital digital{};
 };
 
 // set/get by HID
@@ -60,3 +81,20 @@ void KeySettings_SetOutputCap(uint16_t hid, float val);
 // for ini save/load
 void KeySettings_ClearAll();
 void KeySettings_Enumerate(std::vector<std::pair<uint16_t, KeyDeadzone>>& out);
+
+// Changes on every Set/ClearAll; cache derived data until it moves.
+uint64_t KeySettings_GetGeneration();
+
+// Bulk read of every HID < 256 with useUnique set (one record read per override).
+// generation is the value seen before the copy started, so a concurrent
+// write always makes it stale.
+struct KeySettingsFastCopy
+{
+    uint64_t generation = 0;
+    std::array<uint64_t, 4> uniqueMask{}; // bit per HID
+    std::array<KeyDeadzone, 256> keys{};  // valid where uniqueMask is set
+};
+void KeySettings_CopyFast(KeySettingsFastCopy* out);
+
+// Diagnostics: total seqlock read retries on the HID < 256 fast path.
+uint64_t KeySettings_GetSnapshotRetryCount();
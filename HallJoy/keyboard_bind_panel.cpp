@@ -7,6 +7,7 @@
 
 #include "keyboard_bind_panel.h"
 #include "bindings.h"
+#include "persist_worker.h"
 #include "profile_ini.h"
 #include "win_util.h"
 #include "app_paths.h"
@@ -134,14 +135,14 @@ bool BindPanel_HandleCommand(HWND parent, WPARAM wParam, LPARAM)
     if (id == ID_BIND)
     {
         BindingActions_Apply(GetSelectedAction(), g_selectedHid);
-        Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str()); // autosave
+        PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni()); // autosave
         InvalidateRect(parent, nullptr, FALSE);
         return true;
     }
     if (id == ID_CLEAR)
     {
         Bindings_ClearHid(g_selectedHid);
-        Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str()); // autosave
+        PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni()); // autosave
         InvalidateRect(parent, nullptr, FALSE);
         return true;
     }
@@ -269,6 +269,8 @@ static void ApplyToStorage_NoUndo(const KeyDeadzone& in)
     }
     else
     {
+        // The curve editor (presets, undo) only owns the curve; keep the key's button settings.
+        ks.digital = KeySettings_Get(g_kspSelectedHid).digital;
         KeySettings_Set(g_kspSelectedHid, ks);
     }
 }
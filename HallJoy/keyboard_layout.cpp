@@ -11,6 +11,7 @@
 #include <cwctype>
 
 #include "win_util.h"
+#include "ini_doc.h"
 
 namespace fs = std::filesystem;
 
@@ -416,10 +417,10 @@ namespace
 
     static bool LoadPresetFile(const wchar_t* path, PresetStore& out)
     {
-        if (!path || !path[0]) return false;
-        if (GetFileAttributesW(path) == INVALID_FILE_ATTRIBUTES) return false;
+        IniDoc ini;
+        if (!ini.Load(path)) return false;
 
-        int count = GetPrivateProfileIntW(L"LayoutPreset", L"Count", 0, path);
+        int count = ini.GetInt(L"LayoutPreset", L"Count", 0);
         if (count <= 0) return false;
 
         std::vector<KeyDef> keys;
@@ -431,12 +432,11 @@ namespace
         {
             wchar_t k[64]{};
             swprintf_s(k, L"K%d", i);
-            wchar_t packed[1024]{};
-            GetPrivateProfileStringW(L"LayoutPreset", k, L"", packed, (DWORD)_countof(packed), path);
+            const std::wstring* packed = ini.Find(L"LayoutPreset", k);
 
             KeyDef kd{};
             std::wstring label;
-            if (ParsePackedKeyEntry(packed, kd, label))
+            if (packed && ParsePackedKeyEntry(packed->c_str(), kd, label))
             {
                 keys.push_back(kd);
                 labels.push_back(std::move(label));
@@ -449,8 +449,8 @@ namespace
         out.filePath = path;
         out.keys = std::move(keys);
         out.labels = std::move(labels);
-        out.uniformSpacing = (GetPrivateProfileIntW(L"LayoutPreset", L"UniformSpacing", 0, path) != 0);
-        out.uniformGap = ClampUniformGap(GetPrivateProfileIntW(L"LayoutPreset", L"UniformGap", 8, path));
+        out.uniformSpacing = (ini.GetInt(L"LayoutPreset", L"UniformSpacing", 0) != 0);
+        out.uniformGap = ClampUniformGap(ini.GetInt(L"LayoutPreset", L"UniformGap", 8));
         for (size_t i = 0; i < out.keys.size() && i < out.labels.size(); ++i)
             out.keys[i].label = out.labels[i].c_str();
         return true;
@@ -463,14 +463,10 @@ namespace
         std::error_code ec;
         fs::create_directories(dir, ec);
 
-        WritePrivateProfileStringW(L"LayoutPreset", nullptr, nullptr, p.filePath.c_str());
-
-        wchar_t v[64]{};
-        swprintf_s(v, L"%d", (int)p.keys.size());
-        WritePrivateProfileStringW(L"LayoutPreset", L"Count", v, p.filePath.c_str());
-        WritePrivateProfileStringW(L"LayoutPreset", L"UniformSpacing", p.uniformSpacing ? L"1" : L"0", p.filePath.c_str());
-        swprintf_s(v, L"%d", ClampUniformGap(p.uniformGap));
-        WritePrivateProfileStringW(L"LayoutPreset", L"UniformGap", v, p.filePath.c_str());
+        IniDoc ini;
+        ini.SetInt(L"LayoutPreset", L"Count", (int)p.keys.size());
+        ini.SetInt(L"LayoutPreset", L"UniformSpacing", p.uniformSpacing ? 1 : 0);
+        ini.SetInt(L"LayoutPreset", L"UniformGap", ClampUniformGap(p.uniformGap));
 
         for (int i = 0; i < (int)p.keys.size(); ++i)
         {
@@ -478,9 +474,9 @@ namespace
             wchar_t key[64]{};
             swprintf_s(key, L"K%d", i);
             std::wstring packed = BuildPackedKeyEntry(k);
-            WritePrivateProfileStringW(L"LayoutPreset", key, packed.c_str(), p.filePath.c_str());
+            ini.SetString(L"LayoutPreset", key, packed.c_str());
         }
-        return true;
+        return ini.Save(p.filePath.c_str());
     }
 
     static void EnsureActiveLabelsBound(std::vector<KeyDef>& keys, std::vector<std::wstring>& labels)
@@ -945,16 +941,14 @@ bool KeyboardLayout_StorePresetSnapshot(int presetIdx, const std::vector<KeyDef>
     return true;
 }
 
-bool KeyboardLayout_LoadFromIni(const wchar_t* path)
+bool KeyboardLayout_LoadFromIni(const IniDoc& ini)
 {
-    if (!path) return false;
     EnsureInit();
 
-    wchar_t nameBuf[128]{};
-    GetPrivateProfileStringW(L"KeyboardLayout", L"PresetName", L"", nameBuf, 128, path);
-    if (nameBuf[0])
+    std::wstring name = ini.GetString(L"KeyboardLayout", L"PresetName", L"");
+    if (!name.empty())
     {
-        int idx = FindPresetByName(nameBuf);
+        int idx = FindPresetByName(name);
         if (idx >= 0)
         {
             ActivatePreset(idx);
@@ -966,11 +960,10 @@ bool KeyboardLayout_LoadFromIni(const wchar_t* path)
     return true;
 }
 
-void KeyboardLayout_SaveToIni(const wchar_t* path)
+void KeyboardLayout_SaveToIni(IniDoc& ini)
 {
-    if (!path) return;
     EnsureInit();
 
-    WritePrivateProfileStringW(L"KeyboardLayout", nullptr, nullptr, path);
-    WritePrivateProfileStringW(L"KeyboardLayout", L"PresetName", g_presets[ClampPreset(g_currentPresetIdx)].name.c_str(), path);
+    ini.RemoveSection(L"KeyboardLayout");
+    ini.SetString(L"KeyboardLayout", L"PresetName", g_presets[ClampPreset(g_currentPresetIdx)].name.c_str());
 }
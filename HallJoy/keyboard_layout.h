@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+class IniDoc;
+
 constexpr int KEYBOARD_MARGIN_X = 12;
 constexpr int KEYBOARD_MARGIN_Y = 12;
 constexpr int KEYBOARD_ROW_PITCH_Y = 46;
@@ -40,5 +42,6 @@ bool KeyboardLayout_DeletePreset(int idx);
 bool KeyboardLayout_GetPresetSnapshot(int presetIdx, std::vector<KeyDef>& outKeys, std::vector<std::wstring>& outLabels, bool* outUniformSpacing, int* outUniformGap);
 bool KeyboardLayout_StorePresetSnapshot(int presetIdx, const std::vector<KeyDef>& keys, const std::vector<std::wstring>& labels, bool applyIfActive, bool uniformSpacing, int uniformGap);
 
-bool KeyboardLayout_LoadFromIni(const wchar_t* path);
-void KeyboardLayout_SaveToIni(const wchar_t* path);
+// [KeyboardLayout] section of settings.ini.
+bool KeyboardLayout_LoadFromIni(const IniDoc& ini);
+void KeyboardLayout_SaveToIni(IniDoc& ini);
@@ -22,6 +22,7 @@
 #include "keyboard_render.h"
 #include "backend.h"
 #include "bindings.h"
+#include "persist_worker.h"
 #include "profile_ini.h"
 #include "remap_panel.h"
 #include "keyboard_keysettings_panel.h"
@@ -562,7 +563,7 @@ static int CollectDisplayedActionsByHid(uint16_t hid, DisplayedKeyIconEntry out[
     }
     if (!hid) return 0;
 
-    int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, 4);
+    int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS);
     int count = 0;
     for (int pad = 0; pad < pads; ++pad)
     {
@@ -575,7 +576,7 @@ static int CollectDisplayedActionsByHid(uint16_t hid, DisplayedKeyIconEntry out[
             if (out)
             {
                 out[count].action = act;
-                out[count].padIndex = std::clamp(pad, 0, 3);
+                out[count].padIndex = std::clamp(pad, 0, BINDINGS_MAX_GAMEPADS - 1);
                 out[count].iconIdx = iconIdx;
             }
             ++count;
@@ -697,10 +698,10 @@ static bool HitTestDisplayedIconOnButton(HWND hBtn, uint16_t hid, POINT ptClient
 
 static int GetRemapStyleVariantForPad(int padIndex)
 {
-    int totalPads = std::clamp(Backend_GetVirtualGamepadCount(), 1, 4);
-    padIndex = std::clamp(padIndex, 0, 3);
+    int totalPads = std::clamp(Backend_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS);
+    padIndex = std::clamp(padIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
     if (totalPads <= 1) return 0;
-    return std::clamp(Bindings_GetPadStyleVariant(padIndex), 1, 4);
+    return std::clamp(Bindings_GetPadStyleVariant(padIndex), 1, BINDINGS_MAX_GAMEPADS);
 }
 
 // -----------------------------------------------------------------------------
@@ -892,7 +893,7 @@ static void SwapFly_Stop(bool commit)
         if (g_swapfly.srcHid != 0)
         {
             BindingActions_ApplyForPad(g_swapfly.pendingPadIndex, g_swapfly.pendingAct, g_swapfly.srcHid);
-            Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+            PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
         }
 
         InvalidateKeyByHid(g_swapfly.srcHid);
@@ -955,7 +956,7 @@ static bool SwapFly_Start(HWND hPage, uint16_t srcHid, uint16_t dstHid, BindActi
     g_swapfly.srcHid = srcHid;
     g_swapfly.dstHid = dstHid;
     g_swapfly.pendingAct = pendingAct;
-    g_swapfly.pendingPadIndex = std::clamp(pendingPadIndex, 0, 3);
+    g_swapfly.pendingPadIndex = std::clamp(pendingPadIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
     g_swapfly.iconIdx = iconIdx;
     g_swapfly.startTick = GetTickCount();
     g_swapfly.durationMs = 170;
@@ -1177,7 +1178,7 @@ static bool KeyDel_Start(HWND hPage, HWND hBtn, int iconIdx, int padIndex)
     g_kdel.hPage = hPage;
     g_kdel.running = true;
     g_kdel.iconIdx = iconIdx;
-    g_kdel.padIndex = std::clamp(padIndex, 0, 3);
+    g_kdel.padIndex = std::clamp(padIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
 
     g_kdel.x = (float)(cx - g_kdel.size / 2);
     g_kdel.y = (float)(cy - g_kdel.size / 2);
@@ -1805,7 +1806,7 @@ static LRESULT CALLBACK KeyBtnSubclassProc(HWND hBtn, UINT msg, WPARAM wParam, L
 
                 // Logical unbind happens immediately (visual is handled by overlay ghost)
                 Bindings_ClearHidForPad(padIndex, hid);
-                Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                 InvalidateRect(hBtn, nullptr, FALSE);
             }
         }
@@ -2082,7 +2083,7 @@ static LRESULT CALLBACK PageMainProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM
         {
             uint16_t src = g_kdrag.srcHid;
             uint16_t dst = g_kdrag.hoverHid;
-            int srcPadIndex = std::clamp(g_kdrag.srcPadIndex, 0, 3);
+            int srcPadIndex = std::clamp(g_kdrag.srcPadIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
             BindAction srcAct = g_kdrag.action;
 
             bool copy = (GetKeyState(VK_CONTROL) & 0x8000) != 0;
@@ -2097,7 +2098,7 @@ static LRESULT CALLBACK PageMainProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM
                 {
                     // Unbind immediately
                     Bindings_ClearHidForPad(srcPadIndex, src);
-                    Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                    PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                     InvalidateKeyByHid(src);
 
                     // Visual: shrink dragged ghost to zero (instead of instant hide)
@@ -2133,7 +2134,7 @@ static LRESULT CALLBACK PageMainProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM
                     if (!SwapFly_Start(hWnd, src, dst, dstAct, srcPadIndex))
                     {
                         BindingActions_ApplyForPad(srcPadIndex, dstAct, src);
-                        Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                        PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                         InvalidateKeyByHid(src);
                         InvalidateKeyByHid(dst);
                     }
@@ -2150,7 +2151,7 @@ static LRESULT CALLBACK PageMainProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM
                     if (ActionToGameButton(srcAct, gb))
                     {
                         Bindings_RemoveButtonHidForPad(srcPadIndex, gb, src);
-                        Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                        PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                         InvalidateKeyByHid(src);
                         InvalidateKeyByHid(dst);
                         return 0;
@@ -2166,13 +2167,13 @@ static LRESULT CALLBACK PageMainProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM
                             Bindings_RemoveButtonHidForPad(srcPadIndex, gb, src);
 
                         BindingActions_ApplyForPad(srcPadIndex, srcAct, dst);
-                        Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                        PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                     }
                 }
                 else
                 {
                     BindingActions_ApplyForPad(srcPadIndex, srcAct, dst);
-                    Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                    PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                 }
 
                 InvalidateKeyByHid(src);
@@ -572,10 +572,10 @@ static int FindIconIndexByAction(BindAction a)
 
 static int GetStyleVariantForPad(int padIndex, int totalPads)
 {
-    totalPads = std::clamp(totalPads, 1, 4);
-    padIndex = std::clamp(padIndex, 0, 3);
+    totalPads = std::clamp(totalPads, 1, BINDINGS_MAX_GAMEPADS);
+    padIndex = std::clamp(padIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
     if (totalPads <= 1) return 0;
-    return std::clamp(Bindings_GetPadStyleVariant(padIndex), 1, 4);
+    return std::clamp(Bindings_GetPadStyleVariant(padIndex), 1, BINDINGS_MAX_GAMEPADS);
 }
 
 struct BoundIconEntry
@@ -598,7 +598,7 @@ void KeyboardRender_SetSuppressedBinding(uint16_t hid, int padIndex, BindAction
 {
     g_suppressedBinding.enabled = (hid != 0);
     g_suppressedBinding.hid = hid;
-    g_suppressedBinding.padIndex = std::clamp(padIndex, 0, 3);
+    g_suppressedBinding.padIndex = std::clamp(padIndex, 0, BINDINGS_MAX_GAMEPADS - 1);
     g_suppressedBinding.action = action;
 }
 
@@ -615,7 +615,7 @@ static int CollectDisplayedIconsByHid(uint16_t hid, BoundIconEntry out[4])
     }
     if (!hid) return 0;
 
-    int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, 4);
+    int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS);
     int count = 0;
     for (int pad = 0; pad < pads; ++pad)
     {
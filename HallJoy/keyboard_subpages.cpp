@@ -29,6 +29,7 @@
 #include "keyboard_keysettings_panel_internal.h"
 
 #include "backend.h"
+#include "bindings.h"
 #include "gamepad_render.h"
 #include "ui_theme.h"
 #include "settings.h"
@@ -38,6 +39,9 @@
 #include "premium_combo.h"
 #include "keyboard_layout.h"
 #include "settings_ini.h"
+#include "auto_profile.h"
+#include "persist_worker.h"
+#include "profile_stage.h"
 #include "profile_ini.h"
 #include "app_paths.h"
 #include "global_profiles.h"
@@ -51,6 +55,8 @@ static constexpr UINT WM_APP_APPLY_TIMING = WM_APP + 2;
 static constexpr UINT WM_APP_PROFILE_BEGIN_CREATE = WM_APP + 120;
 static constexpr UINT WM_APP_CONFIG_PROFILE_APPLIED = WM_APP + 121;
 static constexpr UINT WM_APP_GLOBAL_PROFILE_DIRTY = WM_APP + 122;
+static constexpr UINT WM_APP_GLOBAL_PROFILE_STAGED = WM_APP + 123;
+static constexpr UINT WM_APP_GLOBAL_PROFILE_AUTO = WM_APP + 124;
 
 static constexpr UINT_PTR TOAST_TIMER_ID = 8811;
 static constexpr UINT_PTR ANALOG_SELF_TEST_TIMER_ID = 8812;
@@ -135,8 +141,8 @@ LRESULT CALLBACK KeyboardSubpages_TesterPageProc(HWND hWnd, UINT msg, WPARAM wPa
         RECT rcClient{};
         GetClientRect(hWnd, &rcClient);
 
-        int padCount = std::clamp(Backend_GetVirtualGamepadCount(), 1, 4);
-        int cols = (padCount >= 3) ? 2 : padCount;
+        int padCount = std::clamp(Backend_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS);
+        int cols = (padCount >= 5) ? 4 : (padCount >= 3) ? 2 : padCount;
         cols = std::max(1, cols);
         int rows = (padCount + cols - 1) / cols;
 
@@ -2382,6 +2388,10 @@ struct GlobalSettingsPageState
     HWND hToast = nullptr;
     std::wstring toastText;
     DWORD toastHideAt = 0;
+
+    // Profile switch being read off-thread (ProfileStage); 0 = none.
+    uint32_t stagedTicket = 0;
+    std::wstring stagedProfileName;
 };
 
 static constexpr int GLOB_ID_POLL_SLIDER = 7601;
@@ -2696,25 +2706,14 @@ static void Global_RefreshGlobalProfileCombo(GlobalSettingsPageState* st)
     Global_UpdateProfileSaveIcon(st);
 }
 
-static void Global_ApplyActiveGlobalProfile(GlobalSettingsPageState* st, HWND hWnd, const std::wstring& name)
+// Runs once the new profile has been published to the backend. The settings.ini
+// marker is the manual (startup) profile, so auto switches leave it alone.
+static void Global_FinishProfileSwitch(GlobalSettingsPageState* st, HWND hWnd, const std::wstring& newName,
+    bool writeMarker = true)
 {
-    if (!st) return;
-
-    std::wstring newName = GlobalProfiles_SanitizeName(name);
-    if (newName.empty()) newName = L"Default";
-    if (_wcsicmp(newName.c_str(), GlobalProfiles_GetActiveName().c_str()) == 0)
-        return;
-
-    // Persist previous profile state before switching away.
-    const std::wstring prevName = GlobalProfiles_GetActiveName();
-    SettingsIni_SaveProfile(GlobalProfiles_GetSettingsPath(prevName).c_str());
-    Profile_SaveIni(GlobalProfiles_GetBindingsPath(prevName).c_str());
-
     GlobalProfiles_SetActiveName(newName);
-    GlobalProfiles_SaveActiveToSettingsIni(AppPaths_SettingsIni().c_str());
-
-    SettingsIni_LoadProfile(GlobalProfiles_GetSettingsPath(newName).c_str());
-    Profile_LoadIni(GlobalProfiles_GetBindingsPath(newName).c_str());
+    if (writeMarker)
+        GlobalProfiles_SaveStartupToSettingsIni(AppPaths_SettingsIni().c_str());
 
     // Apply runtime timing/backend state from loaded profile.
     RealtimeLoop_SetIntervalMs(Settings_GetPollingMs());
@@ -2738,6 +2737,70 @@ static void Global_ApplyActiveGlobalProfile(GlobalSettingsPageState* st, HWND hW
     Global_UpdateUi(st);
 }
 
+// The new profile is read and decoded off the UI thread and published in one
+// step from WM_APP_GLOBAL_PROFILE_STAGED. `wait` switches before returning.
+static void Global_ApplyActiveGlobalProfile(GlobalSettingsPageState* st, HWND hWnd, const std::wstring& name, bool wait = false)
+{
+    if (!st) return;
+
+    std::wstring newName = GlobalProfiles_SanitizeName(name);
+    if (newName.empty()) newName = L"Default";
+    // Re-selecting the active profile still has to cancel a pending switch.
+    if (_wcsicmp(newName.c_str(), GlobalProfiles_GetActiveName().c_str()) == 0 && st->stagedTicket == 0)
+        return;
+
+    // Persist previous profile state before switching away. Let queued autosaves
+    // land first so they cannot overwrite these writes (or the marker) later.
+    // The active name only changes on publish, so runtime state still belongs to it.
+    PersistWorker_Flush();
+    const std::wstring prevName = GlobalProfiles_GetActiveName();
+    SettingsIni_SaveProfile(GlobalProfiles_GetSettingsPath(prevName).c_str());
+    Profile_SaveIni(GlobalProfiles_GetBindingsPath(prevName).c_str());
+    AutoProfile_CaptureActive();
+
+    if (wait)
+    {
+        st->stagedTicket = 0;
+        st->stagedProfileName.clear();
+        ProfileStage_LoadNow(GlobalProfiles_GetSettingsPath(newName), GlobalProfiles_GetBindingsPath(newName));
+        Global_FinishProfileSwitch(st, hWnd, newName);
+        return;
+    }
+
+    st->stagedProfileName = newName;
+    st->stagedTicket = ProfileStage_Begin(GlobalProfiles_GetSettingsPath(newName),
+        GlobalProfiles_GetBindingsPath(newName), hWnd, WM_APP_GLOBAL_PROFILE_STAGED);
+}
+
+// Foreground-driven switch: a preloaded profile is published straight from
+// memory; the one being left is handed to the persistence worker as a snapshot.
+// Profiles without a usable cache yet take the staged path once.
+static void Global_AutoSwitchProfile(GlobalSettingsPageState* st, HWND hWnd, const std::wstring& name)
+{
+    if (!st) return;
+
+    std::wstring newName = GlobalProfiles_SanitizeName(name);
+    if (newName.empty()) newName = L"Default";
+    if (!AutoProfile_IsPreloaded(newName))
+    {
+        Global_ApplyActiveGlobalProfile(st, hWnd, newName);
+        return;
+    }
+
+    const std::wstring prevName = GlobalProfiles_GetActiveName();
+    if (GlobalProfiles_IsDefault(prevName))
+        PersistWorker_SaveSettings(AppPaths_SettingsIni());
+    else
+        PersistWorker_SaveSettingsProfile(GlobalProfiles_GetSettingsPath(prevName));
+    PersistWorker_SaveBindings(GlobalProfiles_GetBindingsPath(prevName));
+    AutoProfile_CaptureActive();
+
+    st->stagedTicket = 0;
+    st->stagedProfileName.clear();
+    AutoProfile_PublishPreloaded(newName);
+    Global_FinishProfileSwitch(st, hWnd, newName, false);
+}
+
 static void Global_UpdateUi(GlobalSettingsPageState* st)
 {
     if (!st) return;
@@ -2964,6 +3027,7 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
                 }
             }
 
+            PersistWorker_Flush();
             const std::wstring prevName = GlobalProfiles_GetActiveName();
             SettingsIni_SaveProfile(GlobalProfiles_GetSettingsPath(prevName).c_str());
             Profile_SaveIni(GlobalProfiles_GetBindingsPath(prevName).c_str());
@@ -2971,9 +3035,11 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
             // New profile starts as a full copy of current runtime state.
             SettingsIni_SaveProfile(GlobalProfiles_GetSettingsPath(newName).c_str());
             Profile_SaveIni(GlobalProfiles_GetBindingsPath(newName).c_str());
+            AutoProfile_CaptureActive();
+            AutoProfile_SetManualProfile(newName);
 
             GlobalProfiles_SetActiveName(newName);
-            GlobalProfiles_SaveActiveToSettingsIni(AppPaths_SettingsIni().c_str());
+            GlobalProfiles_SaveStartupToSettingsIni(AppPaths_SettingsIni().c_str());
             GlobalProfiles_SetDirty(false);
             Global_RefreshGlobalProfileCombo(st);
             PremiumCombo::ShowDropDown(st->cmbGlobalProfile, false);
@@ -3063,10 +3129,15 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
 
                 // If deleting active profile, switch to default first.
                 if (_wcsicmp(GlobalProfiles_GetActiveName().c_str(), name.c_str()) == 0)
-                    Global_ApplyActiveGlobalProfile(st, hWnd, L"Default");
+                {
+                    AutoProfile_SetManualProfile(L"Default");
+                    Global_ApplyActiveGlobalProfile(st, hWnd, L"Default", true);
+                }
 
+                PersistWorker_Flush();
                 if (GlobalProfiles_Delete(name))
                 {
+                    AutoProfile_Forget(name);
                     Global_RefreshGlobalProfileCombo(st);
                     Global_RequestSave(hWnd);
                     Global_UpdateUi(st);
@@ -3091,6 +3162,7 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
 
         std::wstring settingsPath = AppPaths_ActiveSettingsIni();
         std::wstring bindingsPath = AppPaths_ActiveBindingsIni();
+        PersistWorker_Flush();
         SettingsIni_SaveProfile(settingsPath.c_str());
         Profile_SaveIni(bindingsPath.c_str());
 
@@ -3107,6 +3179,28 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
         return 0;
     }
 
+    if (msg == WM_APP_GLOBAL_PROFILE_AUTO)
+    {
+        std::wstring name;
+        if (st && AutoProfile_TakeRequest(&name))
+            Global_AutoSwitchProfile(st, hWnd, name);
+        return 0;
+    }
+
+    if (msg == WM_APP_GLOBAL_PROFILE_STAGED)
+    {
+        uint32_t ticket = (uint32_t)wParam;
+        if (st && ticket != 0 && ticket == st->stagedTicket)
+        {
+            st->stagedTicket = 0;
+            std::wstring name = std::move(st->stagedProfileName);
+            st->stagedProfileName.clear();
+            ProfileStage_Commit(ticket);
+            Global_FinishProfileSwitch(st, hWnd, name);
+        }
+        return 0;
+    }
+
     switch (msg)
     {
     case WM_ERASEBKGND:
@@ -3202,6 +3296,8 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
             WS_CHILD | WS_VISIBLE, 0, 0, 10, 10, hWnd, nullptr, hInst, nullptr);
         SendMessageW(st->lblHint, WM_SETFONT, (WPARAM)hFont, TRUE);
 
+        AutoProfile_Init(hWnd, WM_APP_GLOBAL_PROFILE_AUTO);
+
         Global_UpdateUi(st);
         Global_Layout(hWnd, st);
         return 0;
@@ -3289,6 +3385,7 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
             {
                 wchar_t nameBuf[260]{};
                 PremiumCombo::GetLBText(st->cmbGlobalProfile, sel, nameBuf, (int)_countof(nameBuf));
+                AutoProfile_SetManualProfile(nameBuf);
                 Global_ApplyActiveGlobalProfile(st, hWnd, nameBuf);
             }
             return 0;
@@ -3334,6 +3431,7 @@ LRESULT CALLBACK KeyboardSubpages_GlobalSettingsPageProc(HWND hWnd, UINT msg, WP
         return 0;
 
     case WM_NCDESTROY:
+        AutoProfile_Shutdown();
         if (st)
         {
             GlobalDeleteConfirm_Clear(hWnd, st);
@@ -18,6 +18,7 @@
 
 #include "keyboard_ui.h"
 #include "backend.h"
+#include "bindings.h"
 #include "keyboard_ui_internal.h"
 #include "keyboard_ui_state.h"
 #include "settings.h"
@@ -206,7 +207,7 @@ void KeyboardUI_OnTimerTick(HWND)
     {
         static uint32_t s_lastTesterHash = 0;
 
-        int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, 4);
+        int pads = std::clamp(Backend_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS);
         uint32_t h = 2166136261u ^ (uint32_t)pads;
         for (int i = 0; i < pads; ++i)
         {
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <windows.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "wooting-analog-wrapper.h"
+
+// Compile-time keycode translation between USB HID usages (keyboard page),
+// scan code set 1 and Windows virtual keys, for the keyboard hook and for the
+// Wooting SDK keycode modes. Scan codes of extended keys are 0xE0xx; the
+// 512-entry "from" tables are indexed by code | (extended ? 0x100 : 0).
+// Virtual keys are the US-layout ones; learned per-key VKs (hook) win over them.
+namespace KeycodeTables
+{
+struct ScanEntry
+{
+    uint8_t scan;
+    uint8_t hid;
+    uint8_t extHid; // HID when the E0 prefix is set; 0 = same key either way, prefix unused
+};
+
+inline constexpr ScanEntry kScanEntries[] = {
+    { 0x01, 41, 0 },   // Esc
+    { 0x02, 30, 0 },   // 1
+    { 0x03, 31, 0 },   // 2
+    { 0x04, 32, 0 },   // 3
+    { 0x05, 33, 0 },   // 4
+    { 0x06, 34, 0 },   // 5
+    { 0x07, 35, 0 },   // 6
+    { 0x08, 36, 0 },   // 7
+    { 0x09, 37, 0 },   // 8
+    { 0x0A, 38, 0 },   // 9
+    { 0x0B, 39, 0 },   // 0
+    { 0x0C, 45, 0 },   // -
+    { 0x0D, 46, 0 },   // =
+    { 0x0E, 42, 0 },   // Backspace
+    { 0x0F, 43, 0 },   // Tab
+    { 0x10, 20, 0 },   // Q
+    { 0x11, 26, 0 },   // W
+    { 0x12, 8, 0 },    // E
+    { 0x13, 21, 0 },   // R
+    { 0x14, 23, 0 },   // T
+    { 0x15, 28, 0 },   // Y
+    { 0x16, 24, 0 },   // U
+    { 0x17, 12, 0 },   // I
+    { 0x18, 18, 0 },   // O
+    { 0x19, 19, 0 },   // P
+    { 0x1A, 47, 0 },   // [
+    { 0x1B, 48, 0 },   // ]
+    { 0x1C, 40, 88 },  // Enter / Numpad Enter
+    { 0x1D, 224, 228 }, // LCtrl / RCtrl
+    { 0x1E, 4, 0 },    // A
+    { 0x1F, 22, 0 },   // S
+    { 0x20, 7, 0 },    // D
+    { 0x21, 9, 0 },    // F
+    { 0x22, 10, 0 },   // G
+    { 0x23, 11, 0 },   // H
+    { 0x24, 13, 0 },   // J
+    { 0x25, 14, 0 },   // K
+    { 0x26, 15, 0 },   // L
+    { 0x27, 51, 0 },   // ;
+    { 0x28, 52, 0 },   // '
+    { 0x29, 53, 0 },   // `
+    { 0x2A, 225, 0 },  // LShift
+    { 0x2B, 49, 0 },   // Backslash
+    { 0x2C, 29, 0 },   // Z
+    { 0x2D, 27, 0 },   // X
+    { 0x2E, 6, 0 },    // C
+    { 0x2F, 25, 0 },   // V
+    { 0x30, 5, 0 },    // B
+    { 0x31, 17, 0 },   // N
+    { 0x32, 16, 0 },   // M
+    { 0x33, 54, 0 },   // ,
+    { 0x34, 55, 0 },   // .
+    { 0x35, 56, 84 },  // / / Numpad /
+    { 0x36, 229, 0 },  // RShift
+    { 0x37, 85, 70 },  // Numpad * / PrintScreen
+    { 0x38, 226, 230 }, // LAlt / RAlt
+    { 0x39, 44, 0 },   // Space
+    { 0x3A, 57, 0 },   // CapsLock
+    { 0x3B, 58, 0 },   // F1
+    { 0x3C, 59, 0 },   // F2
+    { 0x3D, 60, 0 },   // F3
+    { 0x3E, 61, 0 },   // F4
+    { 0x3F, 62, 0 },   // F5
+    { 0x40, 63, 0 },   // F6
+    { 0x41, 64, 0 },   // F7
+    { 0x42, 65, 0 },   // F8
+    { 0x43, 66, 0 },   // F9
+    { 0x44, 67, 0 },   // F10
+    { 0x45, 83, 0 },   // NumLock
+    { 0x46, 71, 0 },   // ScrollLock
+    { 0x47, 95, 74 },  // Numpad 7 / Home
+    { 0x48, 96, 82 },  // Numpad 8 / Up
+    { 0x49, 97, 75 },  // Numpad 9 / PgUp
+    { 0x4A, 86, 0 },   // Numpad -
+    { 0x4B, 92, 80 },  // Numpad 4 / Left
+    { 0x4C, 93, 0 },   // Numpad 5
+    { 0x4D, 94, 79 },  // Numpad 6 / Right
+    { 0x4E, 87, 0 },   // Numpad +
+    { 0x4F, 89, 77 },  // Numpad 1 / End
+    { 0x50, 90, 81 },  // Numpad 2 / Down
+    { 0x51, 91, 78 },  // Numpad 3 / PgDn
+    { 0x52, 98, 73 },  // Numpad 0 / Insert
+    { 0x53, 99, 76 },  // Numpad . / Delete
+    { 0x57, 68, 0 },   // F11
+    { 0x58, 69, 0 },   // F12
+    { 0x5B, 227, 227 }, // LWin (E0)
+    { 0x5C, 231, 231 }, // RWin (E0)
+    { 0x5D, 101, 101 }, // Menu/App (E0)
+};
+
+struct VkEntry
+{
+    uint8_t hid;
+    uint8_t vk;
+};
+
+inline constexpr VkEntry kVkEntries[] = {
+    { 40, VK_RETURN }, { 41, VK_ESCAPE }, { 42, VK_BACK }, { 43, VK_TAB }, { 44, VK_SPACE },
+    { 45, VK_OEM_MINUS }, { 46, VK_OEM_PLUS }, { 47, VK_OEM_4 }, { 48, VK_OEM_6 }, { 49, VK_OEM_5 },
+    { 51, VK_OEM_1 }, { 52, VK_OEM_7 }, { 54, VK_OEM_COMMA }, { 55, VK_OEM_PERIOD }, { 56, VK_OEM_2 },
+    { 57, VK_CAPITAL },
+    { 58, VK_F1 }, { 59, VK_F2 }, { 60, VK_F3 }, { 61, VK_F4 }, { 62, VK_F5 }, { 63, VK_F6 },
+    { 64, VK_F7 }, { 65, VK_F8 }, { 66, VK_F9 }, { 67, VK_F10 }, { 68, VK_F11 }, { 69, VK_F12 },
+    { 73, VK_INSERT }, { 74, VK_HOME }, { 75, VK_PRIOR }, { 76, VK_DELETE }, { 77, VK_END }, { 78, VK_NEXT },
+    { 79, VK_RIGHT }, { 80, VK_LEFT }, { 81, VK_DOWN }, { 82, VK_UP },
+    { 83, VK_NUMLOCK }, { 84, VK_DIVIDE }, { 85, VK_MULTIPLY }, { 86, VK_SUBTRACT }, { 87, VK_ADD },
+    { 89, VK_NUMPAD1 }, { 90, VK_NUMPAD2 }, { 91, VK_NUMPAD3 }, { 92, VK_NUMPAD4 }, { 93, VK_NUMPAD5 },
+    { 94, VK_NUMPAD6 }, { 95, VK_NUMPAD7 }, { 96, VK_NUMPAD8 }, { 97, VK_NUMPAD9 }, { 98, VK_NUMPAD0 },
+    { 99, VK_DECIMAL },
+    { 224, VK_LCONTROL }, { 225, VK_LSHIFT }, { 226, VK_LMENU }, { 227, VK_LWIN },
+    { 228, VK_RCONTROL }, { 229, VK_RSHIFT }, { 230, VK_RMENU }, { 231, VK_RWIN },
+};
+
+// HID -> VK (US layout).
+inline constexpr std::array<uint8_t, 256> kHidToVk = [] {
+    std::array<uint8_t, 256> t{};
+    for (int hid = 4; hid <= 29; ++hid) t[(std::size_t)hid] = (uint8_t)('A' + (hid - 4));
+    for (int hid = 30; hid <= 38; ++hid) t[(std::size_t)hid] = (uint8_t)('1' + (hid - 30));
+    t[39] = '0';
+    for (const VkEntry& e : kVkEntries) t[e.hid] = e.vk;
+    return t;
+}();
+
+// VK (| 0x100 extended) -> HID; only Enter differs by the extended flag.
+inline constexpr std::array<uint8_t, 512> kVkToHid = [] {
+    std::array<uint8_t, 512> t{};
+    for (int hid = 1; hid < 256; ++hid)
+    {
+        const uint8_t vk = kHidToVk[(std::size_t)hid];
+        if (vk == 0) continue;
+        t[vk] = (uint8_t)hid;
+        t[0x100 | vk] = (uint8_t)hid;
+    }
+    t[0x100 | VK_RETURN] = 88; // Numpad Enter
+    return t;
+}();
+
+// Scan code set 1 (| 0x100 extended) -> HID.
+inline constexpr std::array<uint8_t, 512> kScan1ToHid = [] {
+    std::array<uint8_t, 512> t{};
+    for (const ScanEntry& e : kScanEntries)
+    {
+        t[e.scan] = e.hid;
+        t[0x100 | e.scan] = e.extHid ? e.extHid : e.hid;
+    }
+    return t;
+}();
+
+// HID -> scan code set 1, 0xE0xx for keys that only exist with the prefix.
+inline constexpr std::array<uint16_t, 256> kHidToScan1 = [] {
+    std::array<uint16_t, 256> t{};
+    for (const ScanEntry& e : kScanEntries)
+    {
+        t[e.hid] = e.scan;
+        if (e.extHid) t[e.extHid] = (uint16_t)(0xE000u | e.scan);
+    }
+    return t;
+}();
+
+constexpr uint16_t HidFromScan1(uint32_t scan, bool extended)
+{
+    return (scan < 256) ? kScan1ToHid[scan | (extended ? 0x100u : 0u)] : 0;
+}
+
+constexpr uint16_t HidFromVk(uint32_t vk, bool extended)
+{
+    return (vk < 256) ? kVkToHid[vk | (extended ? 0x100u : 0u)] : 0;
+}
+
+constexpr uint16_t HidToVk(uint16_t hid)
+{
+    return (hid < 256) ? kHidToVk[hid] : 0;
+}
+
+constexpr uint16_t HidToScan1(uint16_t hid)
+{
+    return (hid < 256) ? kHidToScan1[hid] : 0;
+}
+
+// Table code of a HID in one SDK keycode mode (0 = no code).
+constexpr uint16_t HidToModeCode(uint16_t hid, WootingAnalog_KeycodeType mode)
+{
+    switch (mode)
+    {
+    case WootingAnalog_KeycodeType_HID: return hid;
+    case WootingAnalog_KeycodeType_ScanCode1: return HidToScan1(hid);
+    case WootingAnalog_KeycodeType_VirtualKey:
+    case WootingAnalog_KeycodeType_VirtualKeyTranslate: return HidToVk(hid);
+    default: return 0;
+    }
+}
+
+// Slot of an SDK mode code in the 512-entry reverse tables: codes < 256 as is,
+// 0xE0xx scan codes at 0x100 | xx, anything else at 0 (never a key).
+constexpr std::size_t ModeCodeIndex(uint16_t code)
+{
+    if (code < 256) return code;
+    if ((code & 0xFF00u) == 0xE000u) return 0x100u | (code & 0xFFu);
+    return 0;
+}
+
+// Mode code -> HID, the exact inverse of HidToModeCode for the table codes.
+inline constexpr std::array<uint8_t, 512> kScan1CodeToHid = [] {
+    std::array<uint8_t, 512> t{};
+    for (int hid = 255; hid >= 1; --hid)
+        if (const uint16_t c = kHidToScan1[(std::size_t)hid]) t[ModeCodeIndex(c)] = (uint8_t)hid;
+    return t;
+}();
+
+inline constexpr std::array<uint8_t, 512> kVkCodeToHid = [] {
+    std::array<uint8_t, 512> t{};
+    for (int hid = 255; hid >= 1; --hid)
+        if (const uint16_t c = kHidToVk[(std::size_t)hid]) t[ModeCodeIndex(c)] = (uint8_t)hid;
+    return t;
+}();
+
+// HID of a table mode code (0 = no key).
+constexpr uint16_t HidFromModeCode(uint16_t code, WootingAnalog_KeycodeType mode)
+{
+    switch (mode)
+    {
+    case WootingAnalog_KeycodeType_HID: return (code < 256) ? code : 0;
+    case WootingAnalog_KeycodeType_ScanCode1: return kScan1CodeToHid[ModeCodeIndex(code)];
+    case WootingAnalog_KeycodeType_VirtualKey:
+    case WootingAnalog_KeycodeType_VirtualKeyTranslate: return kVkCodeToHid[ModeCodeIndex(code)];
+    default: return 0;
+    }
+}
+
+static_assert(HidFromScan1(0x11, false) == 26, "W");
+static_assert(HidFromScan1(0x48, true) == 82 && HidToScan1(82) == 0xE048, "Up arrow");
+static_assert(HidFromVk(VK_RETURN, true) == 88, "Numpad Enter");
+static_assert(HidToVk(4) == 'A' && HidFromVk('A', false) == 4, "A");
+static_assert(HidFromModeCode(0xE048, WootingAnalog_KeycodeType_ScanCode1) == 82, "Up arrow reverse");
+static_assert(HidFromModeCode(VK_RETURN, WootingAnalog_KeycodeType_VirtualKey) == 40, "Enter reverse");
+}
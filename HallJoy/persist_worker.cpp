@@ -0,0 +1,227 @@
+// persist_worker.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "persist_worker.h"
+#include "debug_log.h"
+#include "ini_doc.h"
+#include "profile_ini.h"
+#include "settings_ini.h"
+
+// A file is written once it has been quiet for kQuietMs, but never later than
+// kMaxDelayMs after its first unsaved change (continuous drags still persist).
+static constexpr ULONGLONG kQuietMs = 250;
+static constexpr ULONGLONG kMaxDelayMs = 1500;
+
+struct PendingWrite
+{
+    std::wstring path;
+    IniDoc doc;
+    ULONGLONG firstMs = 0;
+    ULONGLONG lastMs = 0;
+};
+
+static SRWLOCK g_lock = SRWLOCK_INIT;
+static CONDITION_VARIABLE g_idleCv = CONDITION_VARIABLE_INIT;
+static std::vector<PendingWrite> g_pending; // g_lock
+static int g_inFlight = 0;                  // g_lock
+static int g_flushWaiters = 0;              // g_lock: > 0 makes everything due now
+static uint64_t g_submitted = 0;            // g_lock
+static uint64_t g_written = 0;              // g_lock
+static uint64_t g_failed = 0;               // g_lock
+
+static HANDLE g_worker = nullptr;
+static HANDLE g_wakeEvent = nullptr; // auto-reset
+static HANDLE g_stopEvent = nullptr; // manual-reset
+
+static ULONGLONG DueMs(const PendingWrite& p)
+{
+    return std::min(p.lastMs + kQuietMs, p.firstMs + kMaxDelayMs);
+}
+
+static DWORD WINAPI PersistWorkerProc(LPVOID)
+{
+    HANDLE handles[2] = { g_stopEvent, g_wakeEvent };
+    bool stopping = false;
+
+    for (;;)
+    {
+        DWORD waitMs = INFINITE;
+        AcquireSRWLockExclusive(&g_lock);
+        if (!g_pending.empty())
+        {
+            ULONGLONG now = GetTickCount64();
+            ULONGLONG next = ~0ull;
+            for (const PendingWrite& p : g_pending)
+                next = std::min(next, DueMs(p));
+            waitMs = (next <= now) ? 0 : (DWORD)std::min<ULONGLONG>(next - now, kMaxDelayMs);
+        }
+        ReleaseSRWLockExclusive(&g_lock);
+
+        if (!stopping)
+        {
+            DWORD w = WaitForMultipleObjects(2, handles, FALSE, waitMs);
+            stopping = (w == WAIT_OBJECT_0);
+        }
+
+        std::vector<PendingWrite> batch;
+        AcquireSRWLockExclusive(&g_lock);
+        const ULONGLONG now = GetTickCount64();
+        const bool all = stopping || g_flushWaiters > 0;
+        for (size_t i = 0; i < g_pending.size();)
+        {
+            if (all || DueMs(g_pending[i]) <= now)
+            {
+                batch.push_back(std::move(g_pending[i]));
+                g_pending.erase(g_pending.begin() + (ptrdiff_t)i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        g_inFlight += (int)batch.size();
+        ReleaseSRWLockExclusive(&g_lock);
+
+        uint64_t ok = 0, failed = 0;
+        for (const PendingWrite& p : batch)
+        {
+            if (p.doc.Save(p.path.c_str()))
+            {
+                ++ok;
+            }
+            else
+            {
+                ++failed;
+                DebugLog_Write(L"[persist] write failed path=%s err=%lu", p.path.c_str(), GetLastError());
+            }
+        }
+
+        AcquireSRWLockExclusive(&g_lock);
+        g_inFlight -= (int)batch.size();
+        g_written += ok;
+        g_failed += failed;
+        const bool idle = g_pending.empty() && g_inFlight == 0;
+        if (idle)
+            WakeAllConditionVariable(&g_idleCv);
+        ReleaseSRWLockExclusive(&g_lock);
+
+        if (stopping && idle)
+            return 0;
+    }
+}
+
+void PersistWorker_Init()
+{
+    if (g_worker) return;
+
+    g_stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    g_wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (!g_stopEvent || !g_wakeEvent)
+    {
+        DebugLog_Write(L"[persist] CreateEvent failed err=%lu", GetLastError());
+        if (g_stopEvent) { CloseHandle(g_stopEvent); g_stopEvent = nullptr; }
+        if (g_wakeEvent) { CloseHandle(g_wakeEvent); g_wakeEvent = nullptr; }
+        return;
+    }
+
+    g_worker = CreateThread(nullptr, 0, PersistWorkerProc, nullptr, 0, nullptr);
+    if (!g_worker)
+    {
+        DebugLog_Write(L"[persist] CreateThread failed err=%lu", GetLastError());
+        CloseHandle(g_stopEvent); g_stopEvent = nullptr;
+        CloseHandle(g_wakeEvent); g_wakeEvent = nullptr;
+        return;
+    }
+    SetThreadPriority(g_worker, THREAD_PRIORITY_BELOW_NORMAL);
+}
+
+void PersistWorker_Shutdown()
+{
+    if (!g_worker) return;
+
+    SetEvent(g_stopEvent);
+    WaitForSingleObject(g_worker, INFINITE);
+    CloseHandle(g_worker);
+    g_worker = nullptr;
+    CloseHandle(g_stopEvent); g_stopEvent = nullptr;
+    CloseHandle(g_wakeEvent); g_wakeEvent = nullptr;
+
+    DebugLog_Write(L"[persist] shutdown submitted=%llu written=%llu failed=%llu",
+        (unsigned long long)g_submitted, (unsigned long long)g_written, (unsigned long long)g_failed);
+}
+
+void PersistWorker_Submit(const std::wstring& path, IniDoc&& doc)
+{
+    if (path.empty()) return;
+
+    if (!g_worker)
+    {
+        if (!doc.Save(path.c_str()))
+            DebugLog_Write(L"[persist] write failed path=%s err=%lu", path.c_str(), GetLastError());
+        return;
+    }
+
+    const ULONGLONG now = GetTickCount64();
+    AcquireSRWLockExclusive(&g_lock);
+    ++g_submitted;
+    auto it = std::find_if(g_pending.begin(), g_pending.end(), [&](const PendingWrite& p) {
+        return _wcsicmp(p.path.c_str(), path.c_str()) == 0;
+    });
+    if (it != g_pending.end())
+    {
+        it->doc = std::move(doc);
+        it->lastMs = now;
+    }
+    else
+    {
+        PendingWrite p;
+        p.path = path;
+        p.doc = std::move(doc);
+        p.firstMs = now;
+        p.lastMs = now;
+        g_pending.push_back(std::move(p));
+    }
+    ReleaseSRWLockExclusive(&g_lock);
+
+    SetEvent(g_wakeEvent);
+}
+
+void PersistWorker_Flush()
+{
+    if (!g_worker) return;
+
+    AcquireSRWLockExclusive(&g_lock);
+    ++g_flushWaiters;
+    SetEvent(g_wakeEvent);
+    while (!g_pending.empty() || g_inFlight != 0)
+        SleepConditionVariableSRW(&g_idleCv, &g_lock, INFINITE, 0);
+    --g_flushWaiters;
+    ReleaseSRWLockExclusive(&g_lock);
+}
+
+void PersistWorker_SaveSettings(const std::wstring& path)
+{
+    IniDoc doc;
+    SettingsIni_BuildDoc(doc);
+    PersistWorker_Submit(path, std::move(doc));
+}
+
+void PersistWorker_SaveSettingsProfile(const std::wstring& path)
+{
+    IniDoc doc;
+    SettingsIni_BuildProfileDoc(doc);
+    PersistWorker_Submit(path, std::move(doc));
+}
+
+void PersistWorker_SaveBindings(const std::wstring& path)
+{
+    IniDoc doc;
+    Profile_BuildIniDoc(doc);
+    PersistWorker_Submit(path, std::move(doc));
+}
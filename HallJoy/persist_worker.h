@@ -0,0 +1,29 @@
+// persist_worker.h
+#pragma once
+#include <string>
+
+class IniDoc;
+
+// Background writer for config files. The UI thread builds an IniDoc snapshot
+// (in memory, microseconds) and hands it over; the worker keeps only the newest
+// snapshot per file and writes it once that file has been quiet for a short
+// window, so a slider drag that requests dozens of saves ends up as one
+// tmp + atomic replace, off the UI thread.
+//
+// Without PersistWorker_Init (bench, early startup) Submit writes synchronously.
+
+void PersistWorker_Init();
+// Writes everything still pending, then stops the thread.
+void PersistWorker_Shutdown();
+
+// Takes ownership of `doc` (moved from). Replaces any pending snapshot for `path`.
+void PersistWorker_Submit(const std::wstring& path, IniDoc&& doc);
+
+// Blocks until nothing is pending or in flight. Call before reading back or
+// synchronously rewriting a file that may have a pending snapshot.
+void PersistWorker_Flush();
+
+// UI thread: snapshot now, write later.
+void PersistWorker_SaveSettings(const std::wstring& path);        // full settings.ini
+void PersistWorker_SaveSettingsProfile(const std::wstring& path); // profile subset
+void PersistWorker_SaveBindings(const std::wstring& path);
@@ -0,0 +1,359 @@
+// profile_cache.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "profile_cache.h"
+#include "bindings.h"
+#include "debug_log.h"
+#include "ini_util.h"
+#include "key_settings.h"
+#include "profile_ini.h"
+#include "settings_ini.h"
+
+static constexpr uint32_t kCacheMagic = 0x4350484Au; // "JHPC"
+static constexpr uint32_t kCacheVersion = 3;
+static constexpr DWORD kMaxIniBytes = 16u * 1024u * 1024u;
+
+struct CacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t iniHash;
+    uint32_t totalBytes;
+    uint32_t settingsBytes; // sizeof(SettingsProfileValues) at write time
+    uint32_t bindingsBytes; // sizeof(BindingsImage)
+    uint32_t keyBytes;      // sizeof(CacheKey)
+    uint32_t keyCount;
+    uint32_t reserved;
+};
+
+// KeyDeadzone without its padding bytes, so the file is deterministic.
+struct CacheKey
+{
+    uint16_t hid;
+    uint8_t flags; // bit 0 useUnique, bit 1 invert, bit 2 rapidTrigger, bit 3 rtRaw
+    uint8_t curveMode;
+    float low, high, antiDeadzone, outputCap;
+    float cp1x, cp1y, cp2x, cp2y, cp1w, cp2w;
+    float rtDelta, pressPoint, releasePoint;
+};
+static_assert(sizeof(CacheKey) == 56, "CacheKey layout");
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+static double QpcToUs(int64_t d)
+{
+    static LARGE_INTEGER f{};
+    if (f.QuadPart == 0) QueryPerformanceFrequency(&f);
+    return (double)d * 1000000.0 / (double)f.QuadPart;
+}
+
+static std::wstring CachePathFor(const wchar_t* settingsPath)
+{
+    std::wstring p = settingsPath;
+    size_t n = p.size();
+    if (n >= 4 && _wcsicmp(p.c_str() + n - 4, L".ini") == 0)
+        p.resize(n - 4);
+    p += L".cache";
+    return p;
+}
+
+static bool ReadWholeFile(const wchar_t* path, std::vector<char>& out)
+{
+    out.clear();
+    HANDLE h = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (h == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size{};
+    bool ok = GetFileSizeEx(h, &size) && size.QuadPart >= 0 && size.QuadPart <= (LONGLONG)kMaxIniBytes;
+    if (ok)
+    {
+        out.resize((size_t)size.QuadPart);
+        DWORD got = 0;
+        ok = out.empty() || ReadFile(h, out.data(), (DWORD)out.size(), &got, nullptr);
+        out.resize(got);
+    }
+    CloseHandle(h);
+    return ok;
+}
+
+// FNV-1a 64 over both files, with the length mixed in between so moving bytes
+// from one file to the other changes the hash.
+static uint64_t HashInis(const std::vector<char>& settings, const std::vector<char>& bindings)
+{
+    uint64_t h = 1469598103934665603ull;
+    auto mix = [&](const char* p, size_t n) {
+        for (size_t i = 0; i < n; ++i)
+        {
+            h ^= (uint8_t)p[i];
+            h *= 1099511628211ull;
+        }
+    };
+    mix(settings.data(), settings.size());
+    uint64_t len = settings.size();
+    mix((const char*)&len, sizeof(len));
+    mix(bindings.data(), bindings.size());
+    return h;
+}
+
+static size_t ExpectedBytes(uint32_t keyCount)
+{
+    return sizeof(CacheHeader) + sizeof(SettingsProfileValues) + sizeof(BindingsImage) +
+        (size_t)keyCount * sizeof(CacheKey);
+}
+
+static bool ValidateHeader(const CacheHeader& h, size_t fileBytes, uint64_t iniHash)
+{
+    return h.magic == kCacheMagic &&
+        h.version == kCacheVersion &&
+        h.iniHash == iniHash &&
+        h.settingsBytes == sizeof(SettingsProfileValues) &&
+        h.bindingsBytes == sizeof(BindingsImage) &&
+        h.keyBytes == sizeof(CacheKey) &&
+        h.keyCount <= 65535u &&
+        h.totalBytes == fileBytes &&
+        ExpectedBytes(h.keyCount) == fileBytes;
+}
+
+static void DecodeBlob(const uint8_t* base, ProfileImage* out)
+{
+    const CacheHeader* h = (const CacheHeader*)base;
+    const uint8_t* p = base + sizeof(CacheHeader);
+
+    // Sections are packed, not aligned: copy out instead of casting.
+    memcpy(&out->settings, p, sizeof(out->settings));
+    p += sizeof(out->settings);
+    memcpy(&out->bindings, p, sizeof(out->bindings));
+    p += sizeof(out->bindings);
+
+    out->keys.clear();
+    out->keys.reserve(h->keyCount);
+    for (uint32_t i = 0; i < h->keyCount; ++i)
+    {
+        CacheKey ck{};
+        memcpy(&ck, p + (size_t)i * sizeof(CacheKey), sizeof(ck));
+
+        KeyDeadzone ks;
+        ks.useUnique = (ck.flags & 1u) != 0;
+        ks.invert = (ck.flags & 2u) != 0;
+        ks.curveMode = ck.curveMode;
+        ks.low = ck.low;
+        ks.high = ck.high;
+        ks.antiDeadzone = ck.antiDeadzone;
+        ks.outputCap = ck.outputCap;
+        ks.cp1_x = ck.cp1x;
+        ks.cp1_y = ck.cp1y;
+        ks.cp2_x = ck.cp2x;
+        ks.cp2_y = ck.cp2y;
+        ks.cp1_w = ck.cp1w;
+        ks.cp2_w = ck.cp2w;
+        ks.digital.rapidTrigger = (ck.flags & 4u) != 0;
+        ks.digital.rtRaw = (ck.flags & 8u) != 0;
+        ks.digital.rtDelta = ck.rtDelta;
+        ks.digital.pressPoint = ck.pressPoint;
+        ks.digital.releasePoint = ck.releasePoint;
+        out->keys.emplace_back(ck.hid, ks);
+    }
+}
+
+// Maps the cache read-only and decodes it if the header matches.
+static bool TryReadCache(const std::wstring& cachePath, uint64_t iniHash, ProfileImage* out)
+{
+    HANDLE file = CreateFileW(cachePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)ExpectedBytes(0) ||
+        size.QuadPart > (LONGLONG)ExpectedBytes(65535))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) return false;
+
+    const uint8_t* view = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) return false;
+
+    bool ok = false;
+    __try
+    {
+        CacheHeader h{};
+        memcpy(&h, view, sizeof(h));
+        if (ValidateHeader(h, (size_t)size.QuadPart, iniHash))
+        {
+            DecodeBlob(view, out);
+            ok = true;
+        }
+    }
+    __except (GetExceptionCode() == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER : EXCEPTION_CONTINUE_SEARCH)
+    {
+        ok = false;
+    }
+
+    UnmapViewOfFile(view);
+    return ok;
+}
+
+// Captures what the INI loaders just applied.
+static bool WriteCache(const std::wstring& cachePath, uint64_t iniHash)
+{
+    std::vector<std::pair<uint16_t, KeyDeadzone>> keys;
+    KeySettings_Enumerate(keys);
+    if (keys.size() > 65535u) return false;
+
+    std::vector<uint8_t> blob(ExpectedBytes((uint32_t)keys.size()), 0);
+
+    CacheHeader h{};
+    h.magic = kCacheMagic;
+    h.version = kCacheVersion;
+    h.iniHash = iniHash;
+    h.totalBytes = (uint32_t)blob.size();
+    h.settingsBytes = sizeof(SettingsProfileValues);
+    h.bindingsBytes = sizeof(BindingsImage);
+    h.keyBytes = sizeof(CacheKey);
+    h.keyCount = (uint32_t)keys.size();
+
+    uint8_t* p = blob.data();
+    memcpy(p, &h, sizeof(h));
+    p += sizeof(h);
+
+    SettingsProfileValues sv{};
+    SettingsIni_CaptureProfileValues(&sv);
+    memcpy(p, &sv, sizeof(sv));
+    p += sizeof(sv);
+
+    static BindingsImage bi{};
+    Bindings_Export(&bi);
+    memcpy(p, &bi, sizeof(bi));
+    p += sizeof(bi);
+
+    for (const auto& kv : keys)
+    {
+        const KeyDeadzone& ks = kv.second;
+        CacheKey ck{};
+        ck.hid = kv.first;
+        ck.flags = (uint8_t)((ks.useUnique ? 1u : 0u) | (ks.invert ? 2u : 0u) |
+            (ks.digital.rapidTrigger ? 4u : 0u) | (ks.digital.rtRaw ? 8u : 0u));
+        ck.curveMode = ks.curveMode;
+        ck.low = ks.low;
+        ck.high = ks.high;
+        ck.antiDeadzone = ks.antiDeadzone;
+        ck.outputCap = ks.outputCap;
+        ck.cp1x = ks.cp1_x;
+        ck.cp1y = ks.cp1_y;
+        ck.cp2x = ks.cp2_x;
+        ck.cp2y = ks.cp2_y;
+        ck.cp1w = ks.cp1_w;
+        ck.cp2w = ks.cp2_w;
+        ck.rtDelta = ks.digital.rtDelta;
+        ck.pressPoint = ks.digital.pressPoint;
+        ck.releasePoint = ks.digital.releasePoint;
+        memcpy(p, &ck, sizeof(ck));
+        p += sizeof(ck);
+    }
+
+    std::wstring tmp = cachePath + L".tmp";
+    HANDLE f = CreateFileW(tmp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (f == INVALID_HANDLE_VALUE) return false;
+
+    DWORD written = 0;
+    BOOL ok = WriteFile(f, blob.data(), (DWORD)blob.size(), &written, nullptr) && written == (DWORD)blob.size();
+    CloseHandle(f);
+    if (!ok)
+    {
+        DeleteFileW(tmp.c_str());
+        return false;
+    }
+    return IniUtil_AtomicReplace(tmp.c_str(), cachePath.c_str());
+}
+
+static ProfileCacheResult ReadImageInternal(const wchar_t* settingsPath, const wchar_t* bindingsPath,
+    ProfileImage* out, uint64_t* outHash)
+{
+    std::vector<char> settingsBytes, bindingsBytes;
+    if (!ReadWholeFile(settingsPath, settingsBytes))
+        return ProfileCacheResult::NoSettings;
+    if (!ReadWholeFile(bindingsPath, bindingsBytes))
+        return ProfileCacheResult::NoBindings;
+
+    *outHash = HashInis(settingsBytes, bindingsBytes);
+    if (out && TryReadCache(CachePathFor(settingsPath), *outHash, out))
+        return ProfileCacheResult::Hit;
+    return ProfileCacheResult::Miss;
+}
+
+ProfileCacheResult ProfileCache_ReadImage(const wchar_t* settingsPath, const wchar_t* bindingsPath, ProfileImage* out)
+{
+    if (!settingsPath || !bindingsPath || !out) return ProfileCacheResult::NoSettings;
+    uint64_t hash = 0;
+    return ReadImageInternal(settingsPath, bindingsPath, out, &hash);
+}
+
+void ProfileCache_ApplyImage(const ProfileImage& img)
+{
+    SettingsIni_ApplyProfileValues(img.settings);
+    Bindings_Import(img.bindings);
+
+    KeySettings_ClearAll();
+    for (const auto& kv : img.keys)
+        KeySettings_Set(kv.first, kv.second);
+}
+
+void ProfileCache_CaptureImage(ProfileImage* out)
+{
+    if (!out) return;
+    SettingsIni_CaptureProfileValues(&out->settings);
+    Bindings_Export(&out->bindings);
+    KeySettings_Enumerate(out->keys);
+}
+
+bool ProfileCache_LoadProfile(const wchar_t* settingsPath, const wchar_t* bindingsPath)
+{
+    if (!settingsPath || !bindingsPath) return false;
+
+    const int64_t t0 = QpcNow();
+
+    static ProfileImage img; // ~5 KB + keys; UI thread only
+    uint64_t iniHash = 0;
+    switch (ReadImageInternal(settingsPath, bindingsPath, &img, &iniHash))
+    {
+    case ProfileCacheResult::NoSettings:
+        return false;
+    case ProfileCacheResult::NoBindings:
+        // No bindings file: keep the old behaviour (settings only, bindings untouched).
+        return SettingsIni_LoadProfile(settingsPath);
+    case ProfileCacheResult::Hit:
+        ProfileCache_ApplyImage(img);
+        DebugLog_Write(L"[profile.cache] hit path=%s us=%.0f", CachePathFor(settingsPath).c_str(), QpcToUs(QpcNow() - t0));
+        return true;
+    case ProfileCacheResult::Miss:
+        break;
+    }
+
+    if (!SettingsIni_LoadProfile(settingsPath))
+        return false;
+    Profile_LoadIni(bindingsPath);
+
+    const std::wstring cachePath = CachePathFor(settingsPath);
+    bool written = WriteCache(cachePath, iniHash);
+    DebugLog_Write(L"[profile.cache] rebuilt path=%s written=%d us=%.0f",
+        cachePath.c_str(), written ? 1 : 0, QpcToUs(QpcNow() - t0));
+    return true;
+}
@@ -0,0 +1,51 @@
+// profile_cache.h
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "bindings.h"
+#include "key_settings.h"
+#include "settings_ini.h"
+
+// Compiled profile cache: the parsed result of a profile's settings.ini and
+// bindings.ini (profile settings, per-key curves, all pads' bindings) stored
+// as one flat binary file next to the settings INI ("<name>.settings.cache").
+// It is keyed by a hash of both INI files' bytes, so editing either file by
+// hand or saving the profile simply makes the next load rebuild it.
+//
+// Loading a valid cache maps the file and applies it with bulk setters; no
+// INI parsing. UI thread only (same as the INI loaders it replaces).
+
+// Drop-in for SettingsIni_LoadProfile + Profile_LoadIni. Falls back to the INI
+// loaders (and rewrites the cache) when the cache is missing or stale.
+// Returns false if the settings INI does not exist.
+bool ProfileCache_LoadProfile(const wchar_t* settingsPath, const wchar_t* bindingsPath);
+
+// Everything a profile load applies, decoded but not yet published.
+struct ProfileImage
+{
+    SettingsProfileValues settings{};
+    BindingsImage bindings{};
+    std::vector<std::pair<uint16_t, KeyDeadzone>> keys;
+};
+
+enum class ProfileCacheResult
+{
+    Hit,        // `out` filled from a valid cache
+    Miss,       // cache missing or stale: use ProfileCache_LoadProfile on the UI thread
+    NoSettings, // settings INI does not exist
+    NoBindings, // bindings INI does not exist (settings-only load)
+};
+
+// Any thread: reads and hashes both INIs and decodes a valid cache. Touches no
+// runtime state, so a profile switch can do the file work off the UI thread.
+ProfileCacheResult ProfileCache_ReadImage(const wchar_t* settingsPath, const wchar_t* bindingsPath, ProfileImage* out);
+
+// Publishes a decoded image with the bulk setters (settings, all pads' bindings,
+// per-key curves). Callers that need the backend to see it as one change wrap
+// this in Backend_BeginConfigSwap / Backend_EndConfigSwap.
+void ProfileCache_ApplyImage(const ProfileImage& img);
+
+// Current runtime state as an image (what ApplyImage would restore).
+void ProfileCache_CaptureImage(ProfileImage* out);
@@ -5,7 +5,6 @@
 #include <string>
 #include <vector>
 #include <algorithm>
-#include <fstream> // for fast file writing
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -13,14 +12,30 @@
 
 #include "profile_ini.h"
 #include "bindings.h"
-#include "ini_util.h"
+#include "ini_doc.h"
 
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
-static uint16_t ReadU16(const wchar_t* section, const wchar_t* key, uint16_t def, const wchar_t* path)
+static uint16_t ReadU16(const IniDoc& ini, const wchar_t* section, const wchar_t* key, uint16_t def)
 {
-    return (uint16_t)GetPrivateProfileIntW(section, key, def, path);
+    return (uint16_t)ini.GetInt(section, key, def);
+}
+
+static bool PadHasBindings(int pad)
+{
+    static constexpr Axis kAxes[] = { Axis::LX, Axis::LY, Axis::RX, Axis::RY };
+    for (Axis a : kAxes)
+    {
+        AxisBinding b = Bindings_GetAxisForPad(pad, a);
+        if (b.minusHid || b.plusHid) return true;
+    }
+    if (Bindings_GetTriggerForPad(pad, Trigger::LT) || Bindings_GetTriggerForPad(pad, Trigger::RT))
+        return true;
+    for (int b = 0; b <= (int)GameButton::DpadRight; ++b)
+        for (int chunk = 0; chunk < 4; ++chunk)
+            if (Bindings_GetButtonMaskChunkForPad(pad, (GameButton)b, chunk)) return true;
+    return false;
 }
 
 static bool IsSep(wchar_t c)
@@ -97,45 +112,46 @@ static std::wstring MaskToCsvForPad(int padIndex, GameButton b)
     return s;
 }
 
-// NEW: Optimized saving using streams instead of slow WritePrivateProfileString
-static bool Profile_SaveIni_Internal(const wchar_t* path)
+static void Profile_SaveIni_Internal(IniDoc& ini)
 {
-    std::wofstream f(path, std::ios::out | std::ios::trunc);
-    if (!f.is_open()) return false;
+    // Only pads up to the last one with bindings; older builds always wrote 4.
+    int pads = 1;
+    for (int pad = BINDINGS_MAX_GAMEPADS - 1; pad > 0; --pad)
+    {
+        if (PadHasBindings(pad)) { pads = pad + 1; break; }
+    }
 
-    f << L"[General]\n";
-    f << L"Pads=" << BINDINGS_MAX_GAMEPADS << L"\n\n";
+    ini.SetInt(L"General", L"Pads", pads);
 
-    for (int pad = 0; pad < BINDINGS_MAX_GAMEPADS; ++pad)
+    for (int pad = 0; pad < pads; ++pad)
     {
-        const int padNum = pad + 1;
+        wchar_t secAxes[32]{};
+        wchar_t secTriggers[32]{};
+        wchar_t secButtons[32]{};
+        swprintf_s(secAxes, L"Pad%d_Axes", pad + 1);
+        swprintf_s(secTriggers, L"Pad%d_Triggers", pad + 1);
+        swprintf_s(secButtons, L"Pad%d_Buttons", pad + 1);
 
-        // [PadN_Axes]
-        f << L"[Pad" << padNum << L"_Axes]\n";
         auto wAxis = [&](Axis a, const wchar_t* name)
             {
                 AxisBinding b = Bindings_GetAxisForPad(pad, a);
-                f << name << L"_Minus=" << b.minusHid << L"\n";
-                f << name << L"_Plus=" << b.plusHid << L"\n";
+                std::wstring k1 = std::wstring(name) + L"_Minus";
+                std::wstring k2 = std::wstring(name) + L"_Plus";
+                ini.SetUInt(secAxes, k1.c_str(), b.minusHid);
+                ini.SetUInt(secAxes, k2.c_str(), b.plusHid);
             };
         wAxis(Axis::LX, L"LX");
         wAxis(Axis::LY, L"LY");
         wAxis(Axis::RX, L"RX");
         wAxis(Axis::RY, L"RY");
-        f << L"\n";
 
-        // [PadN_Triggers]
-        f << L"[Pad" << padNum << L"_Triggers]\n";
-        f << L"LT=" << Bindings_GetTriggerForPad(pad, Trigger::LT) << L"\n";
-        f << L"RT=" << Bindings_GetTriggerForPad(pad, Trigger::RT) << L"\n";
-        f << L"\n";
+        ini.SetUInt(secTriggers, L"LT", Bindings_GetTriggerForPad(pad, Trigger::LT));
+        ini.SetUInt(secTriggers, L"RT", Bindings_GetTriggerForPad(pad, Trigger::RT));
 
-        // [PadN_Buttons]
-        f << L"[Pad" << padNum << L"_Buttons]\n";
         auto wBtn = [&](GameButton b, const wchar_t* name)
             {
                 std::wstring csv = MaskToCsvForPad(pad, b);
-                f << name << L"=" << csv << L"\n";
+                ini.SetString(secButtons, name, csv.c_str());
             };
 
         wBtn(GameButton::A, L"A");
@@ -154,39 +170,34 @@ static bool Profile_SaveIni_Internal(const wchar_t* path)
         wBtn(GameButton::DpadDown, L"DpadDown");
         wBtn(GameButton::DpadLeft, L"DpadLeft");
         wBtn(GameButton::DpadRight, L"DpadRight");
-        f << L"\n";
     }
+}
 
-    return true;
+void Profile_BuildIniDoc(IniDoc& out)
+{
+    out.Clear();
+    Profile_SaveIni_Internal(out);
 }
 
 bool Profile_SaveIni(const wchar_t* path)
 {
     if (!path) return false;
 
-    std::wstring tmp = std::wstring(path) + L".tmp";
-
-    // Save to tmp file first
-    if (!Profile_SaveIni_Internal(tmp.c_str()))
-    {
-        DeleteFileW(tmp.c_str());
-        return false;
-    }
+    IniDoc ini;
+    Profile_SaveIni_Internal(ini);
 
-    // Atomic replace
-    return IniUtil_AtomicReplace(tmp.c_str(), path);
+    // tmp + atomic replace
+    return ini.Save(path);
 }
 
-static void LoadButtonCsvForPad(int padIndex, const wchar_t* section, GameButton b, const wchar_t* keyName, const wchar_t* path)
+static void LoadButtonCsvForPad(const IniDoc& ini, int padIndex, const wchar_t* section, GameButton b, const wchar_t* keyName)
 {
-    wchar_t buf[2048]{};
-    DWORD n = GetPrivateProfileStringW(section, keyName, L"", buf, (DWORD)(sizeof(buf) / sizeof(buf[0])), path);
-
-    if (n == 0 || buf[0] == 0)
+    const std::wstring* csv = ini.Find(section, keyName);
+    if (!csv || csv->empty())
         return;
 
     std::vector<uint16_t> hids;
-    ParseHidList256(buf, hids);
+    ParseHidList256(csv->c_str(), hids);
     for (uint16_t hid : hids)
         Bindings_AddButtonHidForPad(padIndex, b, hid);
 }
@@ -211,14 +222,14 @@ static void ResetAllBindingsBeforeLoad()
         Bindings_ClearHid(hid);
 }
 
-static void LoadPadBindingsFromSections(int padIndex, const wchar_t* axesSection, const wchar_t* triggersSection, const wchar_t* buttonsSection, const wchar_t* path)
+static void LoadPadBindingsFromSections(const IniDoc& ini, int padIndex, const wchar_t* axesSection, const wchar_t* triggersSection, const wchar_t* buttonsSection)
 {
     auto rAxis = [&](Axis a, const wchar_t* name)
         {
             std::wstring k1 = std::wstring(name) + L"_Minus";
             std::wstring k2 = std::wstring(name) + L"_Plus";
-            uint16_t minusHid = ReadU16(axesSection, k1.c_str(), 0, path);
-            uint16_t plusHid = ReadU16(axesSection, k2.c_str(), 0, path);
+            uint16_t minusHid = ReadU16(ini, axesSection, k1.c_str(), 0);
+            uint16_t plusHid = ReadU16(ini, axesSection, k2.c_str(), 0);
             Bindings_SetAxisMinusForPad(padIndex, a, minusHid);
             Bindings_SetAxisPlusForPad(padIndex, a, plusHid);
         };
@@ -228,37 +239,37 @@ static void LoadPadBindingsFromSections(int padIndex, const wchar_t* axesSection
     rAxis(Axis::RX, L"RX");
     rAxis(Axis::RY, L"RY");
 
-    Bindings_SetTriggerForPad(padIndex, Trigger::LT, ReadU16(triggersSection, L"LT", 0, path));
-    Bindings_SetTriggerForPad(padIndex, Trigger::RT, ReadU16(triggersSection, L"RT", 0, path));
-
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::A, L"A", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::B, L"B", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::X, L"X", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::Y, L"Y", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::LB, L"LB", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::RB, L"RB", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::Back, L"Back", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::Start, L"Start", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::Guide, L"Guide", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::LS, L"LS", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::RS, L"RS", path);
-
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::DpadUp, L"DpadUp", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::DpadDown, L"DpadDown", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::DpadLeft, L"DpadLeft", path);
-    LoadButtonCsvForPad(padIndex, buttonsSection, GameButton::DpadRight, L"DpadRight", path);
+    Bindings_SetTriggerForPad(padIndex, Trigger::LT, ReadU16(ini, triggersSection, L"LT", 0));
+    Bindings_SetTriggerForPad(padIndex, Trigger::RT, ReadU16(ini, triggersSection, L"RT", 0));
+
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::A, L"A");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::B, L"B");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::X, L"X");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::Y, L"Y");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::LB, L"LB");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::RB, L"RB");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::Back, L"Back");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::Start, L"Start");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::Guide, L"Guide");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::LS, L"LS");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::RS, L"RS");
+
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::DpadUp, L"DpadUp");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::DpadDown, L"DpadDown");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::DpadLeft, L"DpadLeft");
+    LoadButtonCsvForPad(ini, padIndex, buttonsSection, GameButton::DpadRight, L"DpadRight");
 }
 
 bool Profile_LoadIni(const wchar_t* path)
 {
-    if (!path) return false;
-
-    DWORD attr = GetFileAttributesW(path);
-    if (attr == INVALID_FILE_ATTRIBUTES) return false;
+    IniDoc ini;
+    if (!ini.Load(path)) return false;
 
     ResetAllBindingsBeforeLoad();
 
-    for (int pad = 0; pad < BINDINGS_MAX_GAMEPADS; ++pad)
+    int pads = ini.GetInt(L"General", L"Pads", 4);
+    pads = std::clamp(pads, 1, BINDINGS_MAX_GAMEPADS);
+    for (int pad = 0; pad < pads; ++pad)
     {
         wchar_t secAxes[32]{};
         wchar_t secTriggers[32]{};
@@ -266,7 +277,7 @@ bool Profile_LoadIni(const wchar_t* path)
         swprintf_s(secAxes, L"Pad%d_Axes", pad + 1);
         swprintf_s(secTriggers, L"Pad%d_Triggers", pad + 1);
         swprintf_s(secButtons, L"Pad%d_Buttons", pad + 1);
-        LoadPadBindingsFromSections(pad, secAxes, secTriggers, secButtons, path);
+        LoadPadBindingsFromSections(ini, pad, secAxes, secTriggers, secButtons);
     }
 
     return true;
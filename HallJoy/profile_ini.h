@@ -2,4 +2,8 @@
 #include <windows.h>
 
 bool Profile_SaveIni(const wchar_t* path);
-bool Profile_LoadIni(const wchar_t* path);
\ No newline at end of file
+bool Profile_LoadIni(const wchar_t* path);
+
+// What Profile_SaveIni would write, without touching the disk.
+class IniDoc;
+void Profile_BuildIniDoc(IniDoc& out);
\ No newline at end of file
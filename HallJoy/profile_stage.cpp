@@ -0,0 +1,188 @@
+// profile_stage.cpp
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <string>
+#include <utility>
+
+#include "profile_stage.h"
+#include "backend.h"
+#include "debug_log.h"
+#include "profile_cache.h"
+
+struct StageJob
+{
+    uint32_t ticket = 0;
+    std::wstring settingsPath;
+    std::wstring bindingsPath;
+    HWND notifyWnd = nullptr;
+    UINT notifyMsg = 0;
+};
+
+struct StagedResult
+{
+    uint32_t ticket = 0; // 0 = nothing staged
+    ProfileCacheResult result = ProfileCacheResult::NoSettings;
+    std::wstring settingsPath;
+    std::wstring bindingsPath;
+    ProfileImage image;
+};
+
+static SRWLOCK g_lock = SRWLOCK_INIT;
+static uint32_t g_latestTicket = 0; // g_lock; only this ticket may commit
+static bool g_pending = false;      // g_lock
+static StagedResult g_staged;       // g_lock
+
+static const wchar_t* ResultName(ProfileCacheResult r)
+{
+    switch (r)
+    {
+    case ProfileCacheResult::Hit: return L"hit";
+    case ProfileCacheResult::Miss: return L"miss";
+    case ProfileCacheResult::NoSettings: return L"no_settings";
+    case ProfileCacheResult::NoBindings: return L"no_bindings";
+    }
+    return L"?";
+}
+
+static void StoreStaged(StagedResult&& r)
+{
+    AcquireSRWLockExclusive(&g_lock);
+    if (r.ticket == g_latestTicket)
+        g_staged = std::move(r);
+    ReleaseSRWLockExclusive(&g_lock);
+}
+
+static void RunJob(const StageJob& job)
+{
+    StagedResult r;
+    r.ticket = job.ticket;
+    r.settingsPath = job.settingsPath;
+    r.bindingsPath = job.bindingsPath;
+    r.result = ProfileCache_ReadImage(job.settingsPath.c_str(), job.bindingsPath.c_str(), &r.image);
+    StoreStaged(std::move(r));
+
+    if (job.notifyWnd)
+        PostMessageW(job.notifyWnd, job.notifyMsg, (WPARAM)job.ticket, 0);
+}
+
+static DWORD WINAPI StageThreadProc(LPVOID param)
+{
+    StageJob* job = (StageJob*)param;
+    RunJob(*job);
+    delete job;
+    return 0;
+}
+
+// Publishes a staged result inside one config-swap bracket.
+static bool Publish(StagedResult& r)
+{
+    if (r.result == ProfileCacheResult::NoSettings)
+    {
+        DebugLog_Write(L"[profile.stage] commit ticket=%u missing settings path=%s",
+            r.ticket, r.settingsPath.c_str());
+        return false;
+    }
+
+    bool ok = true;
+    Backend_BeginConfigSwap();
+    if (r.result == ProfileCacheResult::Hit)
+        ProfileCache_ApplyImage(r.image);
+    else
+        ok = ProfileCache_LoadProfile(r.settingsPath.c_str(), r.bindingsPath.c_str());
+    Backend_EndConfigSwap();
+
+    DebugLog_Write(L"[profile.stage] commit ticket=%u source=%s ok=%d gen=%u",
+        r.ticket, ResultName(r.result), ok ? 1 : 0, Backend_GetConfigGeneration());
+    return ok;
+}
+
+uint32_t ProfileStage_Begin(const std::wstring& settingsPath, const std::wstring& bindingsPath,
+    HWND notifyWnd, UINT notifyMsg)
+{
+    StageJob* job = new StageJob();
+    job->settingsPath = settingsPath;
+    job->bindingsPath = bindingsPath;
+    job->notifyWnd = notifyWnd;
+    job->notifyMsg = notifyMsg;
+
+    AcquireSRWLockExclusive(&g_lock);
+    if (++g_latestTicket == 0) ++g_latestTicket;
+    job->ticket = g_latestTicket;
+    g_pending = true;
+    g_staged = StagedResult{};
+    ReleaseSRWLockExclusive(&g_lock);
+
+    const uint32_t ticket = job->ticket;
+    HANDLE th = CreateThread(nullptr, 0, StageThreadProc, job, 0, nullptr);
+    if (th)
+    {
+        CloseHandle(th);
+    }
+    else
+    {
+        // No thread: do the read here; the commit still arrives as a message.
+        DebugLog_Write(L"[profile.stage] CreateThread failed err=%lu, staging inline", GetLastError());
+        RunJob(*job);
+        delete job;
+    }
+    return ticket;
+}
+
+bool ProfileStage_Commit(uint32_t ticket)
+{
+    StagedResult r;
+    AcquireSRWLockExclusive(&g_lock);
+    const bool current = (ticket != 0 && ticket == g_latestTicket && g_staged.ticket == ticket);
+    if (current)
+    {
+        r = std::move(g_staged);
+        g_staged = StagedResult{};
+        g_pending = false;
+    }
+    ReleaseSRWLockExclusive(&g_lock);
+
+    if (!current)
+    {
+        DebugLog_Write(L"[profile.stage] drop stale ticket=%u", ticket);
+        return false;
+    }
+    return Publish(r);
+}
+
+bool ProfileStage_LoadNow(const std::wstring& settingsPath, const std::wstring& bindingsPath)
+{
+    StagedResult r;
+    AcquireSRWLockExclusive(&g_lock);
+    if (++g_latestTicket == 0) ++g_latestTicket; // supersedes any pending stage
+    r.ticket = g_latestTicket;
+    g_pending = false;
+    g_staged = StagedResult{};
+    ReleaseSRWLockExclusive(&g_lock);
+
+    r.settingsPath = settingsPath;
+    r.bindingsPath = bindingsPath;
+    r.result = ProfileCache_ReadImage(settingsPath.c_str(), bindingsPath.c_str(), &r.image);
+    return Publish(r);
+}
+
+void ProfileStage_PublishImage(const ProfileImage& img)
+{
+    AcquireSRWLockExclusive(&g_lock);
+    if (++g_latestTicket == 0) ++g_latestTicket;
+    g_pending = false;
+    g_staged = StagedResult{};
+    ReleaseSRWLockExclusive(&g_lock);
+
+    Backend_BeginConfigSwap();
+    ProfileCache_ApplyImage(img);
+    Backend_EndConfigSwap();
+}
+
+bool ProfileStage_IsPending()
+{
+    AcquireSRWLockShared(&g_lock);
+    bool pending = g_pending;
+    ReleaseSRWLockShared(&g_lock);
+    return pending;
+}
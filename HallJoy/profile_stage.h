@@ -0,0 +1,34 @@
+// profile_stage.h
+#pragma once
+#include <windows.h>
+#include <cstdint>
+#include <string>
+
+// Staged profile activation. Begin reads and decodes the profile on a worker
+// thread (file I/O, hashing, cache decode) without touching runtime state, then
+// posts `notifyMsg` to `notifyWnd` with wParam = ticket. The window handles it
+// by calling ProfileStage_Commit(ticket), which publishes the whole profile to
+// the backend inside one config-swap bracket.
+//
+// Only the newest Begin can commit: starting another stage makes older tickets
+// stale (their Commit returns false and does nothing).
+
+// UI thread. Returns the ticket (never 0).
+uint32_t ProfileStage_Begin(const std::wstring& settingsPath, const std::wstring& bindingsPath,
+    HWND notifyWnd, UINT notifyMsg);
+
+// UI thread, from the notify message. True if the profile was published.
+// A stale cache is handled here: the INI loaders run (and rebuild the cache)
+// inside the same bracket, so the backend still sees one switch.
+bool ProfileStage_Commit(uint32_t ticket);
+
+// Synchronous Begin + Commit (UI thread), for callers that must not return
+// before the switch happened.
+bool ProfileStage_LoadNow(const std::wstring& settingsPath, const std::wstring& bindingsPath);
+
+// Publishes an image already in memory (no disk), superseding any pending stage.
+struct ProfileImage;
+void ProfileStage_PublishImage(const ProfileImage& img);
+
+// True while a Begin has not been committed or superseded.
+bool ProfileStage_IsPending();
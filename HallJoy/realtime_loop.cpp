@@ -11,6 +11,7 @@
 #include "backend.h"
 #include "settings.h"
 #include "debug_log.h"
+#include "flight_recorder.h"
 
 #pragma comment(lib, "winmm.lib")
 #pragma comment(lib, "avrt.lib")
@@ -20,7 +21,9 @@ static std::atomic<UINT> g_intervalMs{ 5 };
 static std::atomic<UINT> g_lastLoggedIntervalMs{ 0 };
 
 static HANDLE g_thread = nullptr;
+static HANDLE g_watchdogThread = nullptr;
 static HANDLE g_timer = nullptr;
+static HANDLE g_paceTimer = nullptr; // one-shot, armed for the backend's send-pacing deadline
 static HANDLE g_stopEvent = nullptr;
 
 static DWORD g_mmcssTaskIndex = 0;
@@ -59,6 +62,26 @@ static bool ArmTimer(HANDLE hTimer, UINT periodMs)
     return ok != FALSE;
 }
 
+// Arms the pacing timer for the earliest paced report (Backend_GetPacingDeadlineQpc).
+// Nothing pending = leave it unarmed; a one-shot that already fired stays unsignaled.
+static void ArmPaceTimer(HANDLE hTimer, double qpcFreq)
+{
+    if (!hTimer || qpcFreq <= 0.0) return;
+
+    const int64_t dueQpc = Backend_GetPacingDeadlineQpc();
+    if (dueQpc == 0) return;
+
+    LARGE_INTEGER now{};
+    QueryPerformanceCounter(&now);
+    const int64_t leftQpc = dueQpc - (int64_t)now.QuadPart;
+    LONGLONG left100ns = (leftQpc > 0) ? (LONGLONG)((double)leftQpc * 1.0e7 / qpcFreq) : 0;
+    if (left100ns < 1) left100ns = 1;
+
+    LARGE_INTEGER due{};
+    due.QuadPart = -left100ns; // relative
+    SetWaitableTimer(hTimer, &due, 0, nullptr, nullptr, FALSE);
+}
+
 static DWORD WINAPI ThreadProc(LPVOID)
 {
     DebugLog_Write(L"[rt] thread start");
@@ -77,6 +100,7 @@ static DWORD WINAPI ThreadProc(LPVOID)
         timeBeginPeriod(timerPeriodMs);
     }
     bool timerOk = ArmTimer(g_timer, last);
+    FlightRecorder_SetBudgetUs(last * 1000u);
     DebugLog_Write(L"[rt] timer create=%d arm=%d interval=%u", g_timer ? 1 : 0, timerOk ? 1 : 0, last);
 
     ULONGLONG statWinStartMs = GetTickCount64();
@@ -108,6 +132,7 @@ static DWORD WINAPI ThreadProc(LPVOID)
     // Fallback mode: no waitable timer available
     if (!g_timer || !timerOk)
     {
+        // Paced reports go out with the next tick here (no pacing timer).
         DebugLog_Write(L"[rt] fallback mode (WaitForSingleObject)");
         if (g_timer)
         {
@@ -120,6 +145,7 @@ static DWORD WINAPI ThreadProc(LPVOID)
         {
             UINT cur = g_intervalMs.load(std::memory_order_relaxed);
             cur = std::clamp(cur, 1u, 20u);
+            FlightRecorder_SetBudgetUs(cur * 1000u);
 
             if (cur != timerPeriodMs)
             {
@@ -153,22 +179,38 @@ static DWORD WINAPI ThreadProc(LPVOID)
         }
 
         timeEndPeriod(timerPeriodMs);
+        FlightRecorder_SetBudgetUs(0);
         DebugLog_Write(L"[rt] thread exit");
         return 0;
     }
 
-    HANDLE handles[2] = { g_stopEvent, g_timer };
+    LARGE_INTEGER qpcFreq{};
+    QueryPerformanceFrequency(&qpcFreq);
+    g_paceTimer = CreateWaitableTimerHighResCompat();
+    DebugLog_Write(L"[rt] pace timer create=%d", g_paceTimer ? 1 : 0);
+
+    // Without a pace timer, paced reports wait for the next tick.
+    HANDLE handles[3] = { g_stopEvent, g_timer, g_paceTimer };
+    const DWORD handleCount = g_paceTimer ? 3 : 2;
 
     while (g_run.load(std::memory_order_relaxed))
     {
-        DWORD w = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+        DWORD w = WaitForMultipleObjects(handleCount, handles, FALSE, INFINITE);
         if (w == WAIT_OBJECT_0)
             break;
 
+        if (w == WAIT_OBJECT_0 + 2)
+        {
+            Backend_FlushPacedReports();
+            ArmPaceTimer(g_paceTimer, (double)qpcFreq.QuadPart);
+            continue;
+        }
+
         ULONGLONG tickStartMs = GetTickCount64();
         Backend_Tick();
         ULONGLONG tickDurMs = GetTickCount64() - tickStartMs;
         recordTickStats(tickDurMs, last);
+        ArmPaceTimer(g_paceTimer, (double)qpcFreq.QuadPart);
 
         UINT cur = g_intervalMs.load(std::memory_order_relaxed);
         cur = std::clamp(cur, 1u, 20u);
@@ -188,6 +230,7 @@ static DWORD WINAPI ThreadProc(LPVOID)
                 }
             }
             ArmTimer(g_timer, cur); // if it fails, we still continue (next wake might be delayed)
+            FlightRecorder_SetBudgetUs(cur * 1000u);
             DebugLog_Write(L"[rt] timer interval changed to %u", cur);
         }
     }
@@ -198,6 +241,12 @@ static DWORD WINAPI ThreadProc(LPVOID)
         CloseHandle(g_timer);
         g_timer = nullptr;
     }
+    if (g_paceTimer)
+    {
+        CancelWaitableTimer(g_paceTimer);
+        CloseHandle(g_paceTimer);
+        g_paceTimer = nullptr;
+    }
 
     if (g_mmcssHandle)
     {
@@ -207,10 +256,79 @@ static DWORD WINAPI ThreadProc(LPVOID)
     }
 
     timeEndPeriod(timerPeriodMs);
+    FlightRecorder_SetBudgetUs(0);
     DebugLog_Write(L"[rt] thread exit");
     return 0;
 }
 
+// Watchdog: the realtime thread publishes a stage marker (Backend_GetProgress).
+// If neither the tick count nor the stage moves for too long, log which stage and
+// external call it is stuck in and optionally neutralize the pads.
+static constexpr DWORD kWatchdogPollMs = 50;
+static constexpr UINT kWatchdogMinStallMs = 200;
+
+static const wchar_t* WatchdogStageName(int stage)
+{
+    return (stage < 0) ? L"wait(timer)" : Backend_GetTickStageName(stage);
+}
+
+static DWORD WINAPI WatchdogProc(LPVOID)
+{
+    LARGE_INTEGER freq{};
+    QueryPerformanceFrequency(&freq);
+    const double msPerQpc = (freq.QuadPart > 0) ? (1000.0 / (double)freq.QuadPart) : 0.0;
+
+    BackendProgress last{};
+    Backend_GetProgress(&last);
+    ULONGLONG lastMoveMs = GetTickCount64();
+    bool stalled = false;
+    ULONGLONG stallStartMs = 0;
+
+    while (WaitForSingleObject(g_stopEvent, kWatchdogPollMs) == WAIT_TIMEOUT)
+    {
+        BackendProgress cur{};
+        Backend_GetProgress(&cur);
+        ULONGLONG now = GetTickCount64();
+
+        if (cur.ticks != last.ticks || cur.stage != last.stage)
+        {
+            if (stalled)
+            {
+                DebugLog_Write(L"[rt.watchdog] resumed after %llu ms (stage=%s)",
+                    (unsigned long long)(now - stallStartMs), WatchdogStageName(last.stage));
+                stalled = false;
+            }
+            last = cur;
+            lastMoveMs = now;
+            continue;
+        }
+
+        if (stalled)
+            continue;
+
+        UINT interval = std::clamp(g_intervalMs.load(std::memory_order_relaxed), 1u, 20u);
+        UINT stallMs = std::max(kWatchdogMinStallMs, interval * 10u);
+        if (now - lastMoveMs < stallMs)
+            continue;
+
+        stalled = true;
+        stallStartMs = lastMoveMs;
+
+        LARGE_INTEGER qpc{};
+        QueryPerformanceCounter(&qpc);
+        double inStageMs = (cur.stageEnterQpc != 0) ? (double)(qpc.QuadPart - cur.stageEnterQpc) * msPerQpc : 0.0;
+        bool neutralize = Settings_GetWatchdogNeutralizePads() && cur.call != BackendCall_VigemConnect;
+        DebugLog_Write(L"[rt.watchdog] stall stage=%s call=%s in_stage_ms=%.1f ticks=%llu neutralize=%d",
+            WatchdogStageName(cur.stage), Backend_GetCallName(cur.call), inStageMs,
+            (unsigned long long)cur.ticks, neutralize ? 1 : 0);
+
+        FlightRecorder_RequestDump(FlightDumpReason_Stall);
+        if (neutralize)
+            Backend_NeutralizePadsAsync();
+    }
+    return 0;
+}
+
 bool RealtimeLoop_Start()
 {
     if (g_thread) {
@@ -241,6 +359,10 @@ bool RealtimeLoop_Start()
         return false;
     }
 
+    g_watchdogThread = CreateThread(nullptr, 0, WatchdogProc, nullptr, 0, nullptr);
+    if (!g_watchdogThread)
+        DebugLog_Write(L"[rt] watchdog CreateThread failed err=%lu", GetLastError());
+
     DebugLog_Write(L"[rt] start ok thread=%p", g_thread);
     return true;
 }
@@ -260,6 +382,13 @@ void RealtimeLoop_Stop()
     CloseHandle(g_thread);
     g_thread = nullptr;
 
+    if (g_watchdogThread)
+    {
+        WaitForSingleObject(g_watchdogThread, INFINITE);
+        CloseHandle(g_watchdogThread);
+        g_watchdogThread = nullptr;
+    }
+
     if (g_stopEvent)
     {
         CloseHandle(g_stopEvent);
@@ -82,6 +82,10 @@ static RemapIconStyle ResolveStyleVariant(int styleVariant)
     case 2: return { RGB(96, 178, 255),  true  }; // gamepad #2 (sapphire)
     case 3: return { RGB(90, 255, 144), true  }; // gamepad #3 (emerald)
     case 4: return { RGB(255, 111, 135), true  }; // gamepad #4 (ruby)
+    case 5: return { RGB(190, 130, 255), true  }; // gamepad #5 (amethyst)
+    case 6: return { RGB(255, 160, 70),  true  }; // gamepad #6 (amber)
+    case 7: return { RGB(80, 230, 230),  true  }; // gamepad #7 (aqua)
+    case 8: return { RGB(225, 225, 235), true  }; // gamepad #8 (pearl)
     default: return { RGB(255, 212, 92), false }; // single gamepad mode: legacy default look
     }
 }
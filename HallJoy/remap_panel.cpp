@@ -20,7 +20,7 @@
 #pragma comment(lib, "Comctl32.lib")
 
 #include "remap_panel.h"
-#include "profile_ini.h"
+#include "persist_worker.h"
 #include "keyboard_ui.h"
 #include "keyboard_ui_state.h"
 #include "backend.h"
@@ -47,7 +47,7 @@ static constexpr int REMAP_ID_ADD_GAMEPAD = 1901;
 static constexpr int REMAP_ID_REMOVE_GAMEPAD_BASE = 3000;
 static constexpr int REMAP_ICON_ID_BASE = 2100;
 static constexpr int REMAP_ICON_ID_PACK_STRIDE = 128;
-static constexpr int REMAP_MAX_GAMEPADS = 4;
+static constexpr int REMAP_MAX_GAMEPADS = BINDINGS_MAX_GAMEPADS;
 
 static int Remap_GetIconStyleVariantForPack(int packIdx, int totalPacks)
 {
@@ -162,6 +162,10 @@ static COLORREF Remap_GetAccentColorForStyleVariant(int styleVariant)
     case 2: return RGB(96, 178, 255);   // sapphire
     case 3: return RGB(90, 255, 144);   // emerald
     case 4: return RGB(255, 111, 135);  // ruby
+    case 5: return RGB(190, 130, 255);  // amethyst
+    case 6: return RGB(255, 160, 70);   // amber
+    case 7: return RGB(80, 230, 230);   // aqua
+    case 8: return RGB(225, 225, 235);  // pearl
     default: return RGB(128, 136, 150); // neutral
     }
 }
@@ -1920,7 +1924,7 @@ static void ApplyBindingNow(HWND hWnd, RemapPanelState* st, uint16_t newHid)
     uint16_t oldHid = GetOldHidForAction(st->dragPadIndex, act);
 
     BindingActions_ApplyForPad(st->dragPadIndex, act, newHid);
-    Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+    PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
     InvalidateHidKey(oldHid);
     InvalidateHidKey(newHid);
     if (st->hKeyboardHost) InvalidateRect(st->hKeyboardHost, nullptr, FALSE);
@@ -2288,7 +2292,7 @@ static LRESULT CALLBACK RemapPanelProc(HWND hWnd, UINT msg, WPARAM wParam, LPARA
 
                     // Remove selected pad and keep following pads (shift left).
                     Bindings_RemovePadAndCompact(packIdx, st->gamepadPacks);
-                    Profile_SaveIni(AppPaths_ActiveBindingsIni().c_str());
+                    PersistWorker_SaveBindings(AppPaths_ActiveBindingsIni());
                     Settings_SetVirtualGamepadCount(newCount);
                     Backend_SetVirtualGamepadCount(newCount);
 
@@ -1,12 +1,16 @@
 // settings.cpp
 #define NOMINMAX
 #include "settings.h"
+#include "bindings.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 static uint32_t PackDz(int lowM, int highM)
 {
@@ -58,6 +62,25 @@ static std::atomic<UINT> g_globalCurveMode{ 1 };
 // Global invert
 static std::atomic<bool> g_globalInvert{ false };
 
+// Input smoothing (One Euro)
+static std::atomic<bool> g_inputSmoothing{ false };
+static std::atomic<int> g_inputSmoothingMinCutoffM{ 1000 }; // 1.0 Hz
+static std::atomic<int> g_inputSmoothingBetaM{ 2000 };      // 2.0
+
+// Input prediction
+static std::atomic<bool> g_inputPrediction{ false };
+static std::atomic<int> g_inputPredictionHorizonUs{ 2000 }; // 2 ms
+
+// Report change detection, per pad (defaults: SettingsSnapshot::ReportPolicy)
+static_assert(SETTINGS_MAX_GAMEPADS == BINDINGS_MAX_GAMEPADS);
+static std::array<std::atomic<UINT>, SETTINGS_MAX_GAMEPADS> g_reportPolicy{ {
+    SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive,
+    SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive, SettingsReportPolicy_Adaptive
+} };
+static std::array<std::atomic<int>, SETTINGS_MAX_GAMEPADS> g_reportStickThreshold{ { 256, 256, 256, 256, 256, 256, 256, 256 } };
+static std::array<std::atomic<int>, SETTINGS_MAX_GAMEPADS> g_reportTriggerThreshold{ { 2, 2, 2, 2, 2, 2, 2, 2 } };
+static std::array<std::atomic<UINT>, SETTINGS_MAX_GAMEPADS> g_reportFlushMs{ { 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u } };
+
 // ---------------- NEW: Snappy Joystick ----------------
 static std::atomic<bool> g_snappyJoystick{ false };
 static std::atomic<bool> g_lastKeyPriority{ false };
@@ -65,6 +88,7 @@ static std::atomic<int> g_lastKeyPrioritySensitivityM{ 120 }; // 0.120 default
 static std::atomic<bool> g_blockBoundKeys{ false };
 static std::atomic<bool> g_blockMouseInput{ false };
 static std::atomic<bool> g_digitalFallbackInput{ false };
+static std::atomic<bool> g_watchdogNeutralizePads{ true };
 static std::atomic<UINT> g_aulaCommMode{ SettingsAulaCommMode_94Passive };
 static std::atomic<bool> g_mouseToStickEnabled{ false };
 static std::atomic<int> g_mouseToStickTarget{ 1 }; // default: right stick
@@ -79,6 +103,18 @@ static constexpr UINT kDragIconSizePx = 46;
 static constexpr UINT kBoundKeyIconPx = 37;
 static constexpr bool kBoundIconBacking = false;
 
+// Realtime snapshot: the struct is copied through atomic 64-bit words under a
+// sequence counter so readers never observe a partially written snapshot.
+static_assert(std::is_trivially_copyable_v<SettingsSnapshot>);
+static constexpr size_t kSnapshotWords = (sizeof(SettingsSnapshot) + 7) / 8;
+static std::atomic<uint32_t> g_snapSeq{ 0 }; // 0 = never published, odd = writer active
+static std::array<std::atomic<uint64_t>, kSnapshotWords> g_snapWords{};
+static std::atomic<uint64_t> g_snapVersion{ 0 };
+static SRWLOCK g_snapWriteLock = SRWLOCK_INIT;
+
+static SettingsSnapshot BuildSnapshot();
+static void PublishSnapshot();
+
 // ---------------- Deadzone X ----------------
 void Settings_SetInputDeadzoneLow(float v01)
 {
@@ -96,8 +132,9 @@ void Settings_SetInputDeadzoneLow(float v01)
 
         uint32_t nw = PackDz(newLowM, newHighM);
         if (g_inDzPacked.compare_exchange_weak(old, nw, std::memory_order_release, std::memory_order_relaxed))
-            return;
+            break;
     }
+    PublishSnapshot();
 }
 
 float Settings_GetInputDeadzoneLow()
@@ -125,8 +162,9 @@ void Settings_SetInputDeadzoneHigh(float v01)
 
         uint32_t nw = PackDz(newLowM, newHighM);
         if (g_inDzPacked.compare_exchange_weak(old, nw, std::memory_order_release, std::memory_order_relaxed))
-            return;
+            break;
     }
+    PublishSnapshot();
 }
 
 float Settings_GetInputDeadzoneHigh()
@@ -165,6 +203,7 @@ void Settings_SetInputAntiDeadzone(float v01)
     if (m > cap - 10) m = std::max(0, cap - 10);
 
     g_globalAntiDzM.store(std::clamp(m, 0, 990), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetInputAntiDeadzone()
@@ -182,6 +221,7 @@ void Settings_SetInputOutputCap(float v01)
     if (m < adz + 10) m = std::min(1000, adz + 10);
 
     g_globalOutCapM.store(std::clamp(m, 10, 1000), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetInputOutputCap()
@@ -196,6 +236,7 @@ void Settings_SetInputBezierCp1X(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC1xM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp1X()
 {
@@ -206,6 +247,7 @@ void Settings_SetInputBezierCp1Y(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC1yM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp1Y()
 {
@@ -216,6 +258,7 @@ void Settings_SetInputBezierCp2X(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC2xM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp2X()
 {
@@ -226,6 +269,7 @@ void Settings_SetInputBezierCp2Y(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC2yM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp2Y()
 {
@@ -237,6 +281,7 @@ void Settings_SetInputBezierCp1W(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC1wM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp1W()
 {
@@ -247,6 +292,7 @@ void Settings_SetInputBezierCp2W(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.0f, 1.0f) * 1000.0f);
     g_globalC2wM.store(ClampM01(m), std::memory_order_release);
+    PublishSnapshot();
 }
 float Settings_GetInputBezierCp2W()
 {
@@ -258,6 +304,7 @@ void Settings_SetInputCurveMode(UINT mode)
 {
     mode = std::clamp(mode, 0u, 1u);
     g_globalCurveMode.store(mode, std::memory_order_release);
+    PublishSnapshot();
 }
 
 UINT Settings_GetInputCurveMode()
@@ -269,6 +316,7 @@ UINT Settings_GetInputCurveMode()
 void Settings_SetInputInvert(bool on)
 {
     g_globalInvert.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetInputInvert()
@@ -280,6 +328,7 @@ bool Settings_GetInputInvert()
 void Settings_SetSnappyJoystick(bool on)
 {
     g_snappyJoystick.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetSnappyJoystick()
@@ -290,6 +339,7 @@ bool Settings_GetSnappyJoystick()
 void Settings_SetLastKeyPriority(bool on)
 {
     g_lastKeyPriority.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetLastKeyPriority()
@@ -297,10 +347,128 @@ bool Settings_GetLastKeyPriority()
     return g_lastKeyPriority.load(std::memory_order_acquire);
 }
 
+void Settings_SetInputSmoothing(bool on)
+{
+    g_inputSmoothing.store(on, std::memory_order_release);
+    PublishSnapshot();
+}
+
+bool Settings_GetInputSmoothing()
+{
+    return g_inputSmoothing.load(std::memory_order_acquire);
+}
+
+void Settings_SetInputSmoothingMinCutoffHz(float hz)
+{
+    int m = (int)lroundf(std::clamp(hz, 0.1f, 30.0f) * 1000.0f);
+    g_inputSmoothingMinCutoffM.store(std::clamp(m, 100, 30000), std::memory_order_release);
+    PublishSnapshot();
+}
+
+float Settings_GetInputSmoothingMinCutoffHz()
+{
+    int m = g_inputSmoothingMinCutoffM.load(std::memory_order_acquire);
+    return (float)std::clamp(m, 100, 30000) / 1000.0f;
+}
+
+void Settings_SetInputSmoothingBeta(float beta)
+{
+    int m = (int)lroundf(std::clamp(beta, 0.0f, 50.0f) * 1000.0f);
+    g_inputSmoothingBetaM.store(std::clamp(m, 0, 50000), std::memory_order_release);
+    PublishSnapshot();
+}
+
+float Settings_GetInputSmoothingBeta()
+{
+    int m = g_inputSmoothingBetaM.load(std::memory_order_acquire);
+    return (float)std::clamp(m, 0, 50000) / 1000.0f;
+}
+
+void Settings_SetInputPrediction(bool on)
+{
+    g_inputPrediction.store(on, std::memory_order_release);
+    PublishSnapshot();
+}
+
+bool Settings_GetInputPrediction()
+{
+    return g_inputPrediction.load(std::memory_order_acquire);
+}
+
+void Settings_SetInputPredictionHorizonMs(float ms)
+{
+    int us = (int)lroundf(std::clamp(ms, 0.25f, 5.0f) * 1000.0f);
+    g_inputPredictionHorizonUs.store(std::clamp(us, 250, 5000), std::memory_order_release);
+    PublishSnapshot();
+}
+
+float Settings_GetInputPredictionHorizonMs()
+{
+    int us = g_inputPredictionHorizonUs.load(std::memory_order_acquire);
+    return (float)std::clamp(us, 250, 5000) / 1000.0f;
+}
+
+static bool ValidPad(int pad) { return pad >= 0 && pad < SETTINGS_MAX_GAMEPADS; }
+
+void Settings_SetReportPolicy(int pad, UINT policy)
+{
+    if (!ValidPad(pad)) return;
+    policy = std::clamp(policy, (UINT)SettingsReportPolicy_Exact, (UINT)SettingsReportPolicy_Adaptive);
+    g_reportPolicy[(size_t)pad].store(policy, std::memory_order_release);
+    PublishSnapshot();
+}
+
+UINT Settings_GetReportPolicy(int pad)
+{
+    if (!ValidPad(pad)) return SettingsReportPolicy_Adaptive;
+    UINT policy = g_reportPolicy[(size_t)pad].load(std::memory_order_acquire);
+    return std::clamp(policy, (UINT)SettingsReportPolicy_Exact, (UINT)SettingsReportPolicy_Adaptive);
+}
+
+void Settings_SetReportStickThreshold(int pad, int units)
+{
+    if (!ValidPad(pad)) return;
+    g_reportStickThreshold[(size_t)pad].store(std::clamp(units, 1, 8192), std::memory_order_release);
+    PublishSnapshot();
+}
+
+int Settings_GetReportStickThreshold(int pad)
+{
+    if (!ValidPad(pad)) return 256;
+    return std::clamp(g_reportStickThreshold[(size_t)pad].load(std::memory_order_acquire), 1, 8192);
+}
+
+void Settings_SetReportTriggerThreshold(int pad, int units)
+{
+    if (!ValidPad(pad)) return;
+    g_reportTriggerThreshold[(size_t)pad].store(std::clamp(units, 1, 64), std::memory_order_release);
+    PublishSnapshot();
+}
+
+int Settings_GetReportTriggerThreshold(int pad)
+{
+    if (!ValidPad(pad)) return 2;
+    return std::clamp(g_reportTriggerThreshold[(size_t)pad].load(std::memory_order_acquire), 1, 64);
+}
+
+void Settings_SetReportFlushMs(int pad, UINT ms)
+{
+    if (!ValidPad(pad)) return;
+    g_reportFlushMs[(size_t)pad].store(std::clamp(ms, 4u, 250u), std::memory_order_release);
+    PublishSnapshot();
+}
+
+UINT Settings_GetReportFlushMs(int pad)
+{
+    if (!ValidPad(pad)) return 10;
+    return std::clamp(g_reportFlushMs[(size_t)pad].load(std::memory_order_acquire), 4u, 250u);
+}
+
 void Settings_SetLastKeyPrioritySensitivity(float v01)
 {
     int m = (int)lroundf(std::clamp(v01, 0.02f, 0.95f) * 1000.0f);
     g_lastKeyPrioritySensitivityM.store(std::clamp(m, 20, 950), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetLastKeyPrioritySensitivity()
@@ -313,6 +481,7 @@ float Settings_GetLastKeyPrioritySensitivity()
 void Settings_SetBlockBoundKeys(bool on)
 {
     g_blockBoundKeys.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetBlockBoundKeys()
@@ -323,6 +492,7 @@ bool Settings_GetBlockBoundKeys()
 void Settings_SetBlockMouseInput(bool on)
 {
     g_blockMouseInput.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetBlockMouseInput()
@@ -333,6 +503,7 @@ bool Settings_GetBlockMouseInput()
 void Settings_SetDigitalFallbackInput(bool on)
 {
     g_digitalFallbackInput.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetDigitalFallbackInput()
@@ -340,6 +511,16 @@ bool Settings_GetDigitalFallbackInput()
     return g_digitalFallbackInput.load(std::memory_order_acquire);
 }
 
+void Settings_SetWatchdogNeutralizePads(bool on)
+{
+    g_watchdogNeutralizePads.store(on, std::memory_order_release);
+}
+
+bool Settings_GetWatchdogNeutralizePads()
+{
+    return g_watchdogNeutralizePads.load(std::memory_order_acquire);
+}
+
 void Settings_SetAulaCommMode(UINT mode)
 {
     mode = std::clamp(mode, (UINT)SettingsAulaCommMode_98Only, (UINT)SettingsAulaCommMode_94ActiveExperimental);
@@ -355,6 +536,7 @@ UINT Settings_GetAulaCommMode()
 void Settings_SetMouseToStickEnabled(bool on)
 {
     g_mouseToStickEnabled.store(on, std::memory_order_release);
+    PublishSnapshot();
 }
 
 bool Settings_GetMouseToStickEnabled()
@@ -366,6 +548,7 @@ void Settings_SetMouseToStickTarget(int target)
 {
     target = std::clamp(target, 0, 1);
     g_mouseToStickTarget.store(target, std::memory_order_release);
+    PublishSnapshot();
 }
 
 int Settings_GetMouseToStickTarget()
@@ -377,6 +560,7 @@ void Settings_SetMouseToStickSensitivity(float v)
 {
     int m = (int)lroundf(std::clamp(v, 0.1f, 8.0f) * 1000.0f);
     g_mouseToStickSensitivityM.store(std::clamp(m, 100, 8000), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetMouseToStickSensitivity()
@@ -390,6 +574,7 @@ void Settings_SetMouseToStickAggressiveness(float v)
 {
     int m = (int)lroundf(std::clamp(v, 0.2f, 3.0f) * 1000.0f);
     g_mouseToStickAggressivenessM.store(std::clamp(m, 200, 3000), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetMouseToStickAggressiveness()
@@ -403,6 +588,7 @@ void Settings_SetMouseToStickMaxOffset(float v)
 {
     int m = (int)lroundf(std::clamp(v, 0.0f, 6.0f) * 1000.0f);
     g_mouseToStickMaxOffsetM.store(std::clamp(m, 0, 6000), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetMouseToStickMaxOffset()
@@ -416,6 +602,7 @@ void Settings_SetMouseToStickFollowSpeed(float v)
 {
     int m = (int)lroundf(std::clamp(v, 0.2f, 3.0f) * 1000.0f);
     g_mouseToStickFollowSpeedM.store(std::clamp(m, 200, 3000), std::memory_order_release);
+    PublishSnapshot();
 }
 
 float Settings_GetMouseToStickFollowSpeed()
@@ -430,6 +617,7 @@ void Settings_SetPollingMs(UINT ms)
 {
     ms = std::clamp(ms, 1u, 20u);
     g_pollMs.store(ms, std::memory_order_release);
+    PublishSnapshot();
 }
 
 UINT Settings_GetPollingMs()
@@ -450,7 +638,7 @@ UINT Settings_GetUIRefreshMs()
 
 void Settings_SetVirtualGamepadCount(int count)
 {
-    count = std::clamp(count, 1, 4);
+    count = std::clamp(count, 1, BINDINGS_MAX_GAMEPADS);
     g_virtualGamepadCount.store(count, std::memory_order_release);
 }
 
@@ -527,3 +715,111 @@ int Settings_GetMainWindowPosYPx()
 {
     return g_mainWinY.load(std::memory_order_acquire);
 }
+
+// ---------------- Realtime snapshot ----------------
+static SettingsSnapshot BuildSnapshot()
+{
+    SettingsSnapshot s{};
+    s.inputInvert = Settings_GetInputInvert();
+    s.inputCurveMode = Settings_GetInputCurveMode();
+    s.inputDeadzoneLow = Settings_GetInputDeadzoneLow();
+    s.inputDeadzoneHigh = Settings_GetInputDeadzoneHigh();
+    s.inputAntiDeadzone = Settings_GetInputAntiDeadzone();
+    s.inputOutputCap = Settings_GetInputOutputCap();
+    s.inputBezierCp1X = Settings_GetInputBezierCp1X();
+    s.inputBezierCp1Y = Settings_GetInputBezierCp1Y();
+    s.inputBezierCp2X = Settings_GetInputBezierCp2X();
+    s.inputBezierCp2Y = Settings_GetInputBezierCp2Y();
+    s.inputBezierCp1W = Settings_GetInputBezierCp1W();
+    s.inputBezierCp2W = Settings_GetInputBezierCp2W();
+
+    s.snappyJoystick = Settings_GetSnappyJoystick();
+    s.lastKeyPriority = Settings_GetLastKeyPriority();
+    s.lastKeyPrioritySensitivity = Settings_GetLastKeyPrioritySensitivity();
+
+    s.inputSmoothing = Settings_GetInputSmoothing();
+    s.inputSmoothingMinCutoffHz = Settings_GetInputSmoothingMinCutoffHz();
+    s.inputSmoothingBeta = Settings_GetInputSmoothingBeta();
+    s.inputPrediction = Settings_GetInputPrediction();
+    s.inputPredictionHorizonMs = Settings_GetInputPredictionHorizonMs();
+
+    for (int pad = 0; pad < SETTINGS_MAX_GAMEPADS; ++pad)
+    {
+        SettingsSnapshot::ReportPolicy& rp = s.reportPolicy[pad];
+        rp.policy = (uint8_t)Settings_GetReportPolicy(pad);
+        rp.triggerThreshold = (uint8_t)Settings_GetReportTriggerThreshold(pad);
+        rp.stickThreshold = (uint16_t)Settings_GetReportStickThreshold(pad);
+        rp.flushMs = (uint16_t)Settings_GetReportFlushMs(pad);
+    }
+
+    s.digitalFallbackInput = Settings_GetDigitalFallbackInput();
+    s.blockBoundKeys = Settings_GetBlockBoundKeys();
+    s.blockMouseInput = Settings_GetBlockMouseInput();
+    s.pollingMs = Settings_GetPollingMs();
+
+    s.mouseToStickEnabled = Settings_GetMouseToStickEnabled();
+    s.mouseToStickTarget = Settings_GetMouseToStickTarget();
+    s.mouseToStickSensitivity = Settings_GetMouseToStickSensitivity();
+    s.mouseToStickAggressiveness = Settings_GetMouseToStickAggressiveness();
+    s.mouseToStickMaxOffset = Settings_GetMouseToStickMaxOffset();
+    s.mouseToStickFollowSpeed = Settings_GetMouseToStickFollowSpeed();
+    return s;
+}
+
+// Writers are serialized; each rebuilds from the atomics, so the last publish
+// always reflects the latest value of every field.
+static void PublishSnapshot()
+{
+    AcquireSRWLockExclusive(&g_snapWriteLock);
+
+    SettingsSnapshot snap = BuildSnapshot();
+    snap.version = g_snapVersion.load(std::memory_order_relaxed) + 1;
+
+    uint64_t words[kSnapshotWords]{};
+    memcpy(words, &snap, sizeof(snap));
+
+    g_snapSeq.fetch_add(1u, std::memory_order_acq_rel); // odd => writer in progress
+    for (size_t i = 0; i < kSnapshotWords; ++i)
+        g_snapWords[i].store(words[i], std::memory_order_relaxed);
+    g_snapSeq.fetch_add(1u, std::memory_order_release); // even => stable
+
+    g_snapVersion.store(snap.version, std::memory_order_release);
+    ReleaseSRWLockExclusive(&g_snapWriteLock);
+}
+
+void Settings_GetSnapshot(SettingsSnapshot* out)
+{
+    if (!out) return;
+
+    for (;;)
+    {
+        uint32_t s1 = g_snapSeq.load(std::memory_order_acquire);
+        if (s1 == 0)
+        {
+            // Nothing set yet: defaults straight from the atomics.
+            *out = BuildSnapshot();
+            return;
+        }
+        if (s1 & 1u)
+        {
+            YieldProcessor();
+            continue;
+        }
+
+        uint64_t words[kSnapshotWords]{};
+        for (size_t i = 0; i < kSnapshotWords; ++i)
+            words[i] = g_snapWords[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_snapSeq.load(std::memory_order_relaxed) == s1)
+        {
+            memcpy(out, words, sizeof(*out));
+            return;
+        }
+    }
+}
+
+uint64_t Settings_GetSnapshotVersion()
+{
+    return g_snapVersion.load(std::memory_order_acquire);
+}
@@ -1,6 +1,7 @@
 // settings.h
 #pragma once
 #include <windows.h>
+#include <cstdint>
 
 // Input deadzones for analog key readings (0..1):
 // - Low: everything below becomes 0, remaining range is rescaled
@@ -50,6 +51,23 @@ UINT Settings_GetInputCurveMode();
 void Settings_SetInputInvert(bool on);
 bool Settings_GetInputInvert();
 
+// Adaptive smoothing (One Euro filter) of every analog key before its curve.
+// Heavy smoothing while a key is still (MinCutoffHz), almost none while it moves
+// fast (cutoff rises by Beta per unit/s of travel speed). Off by default.
+void Settings_SetInputSmoothing(bool on);
+bool Settings_GetInputSmoothing();
+void Settings_SetInputSmoothingMinCutoffHz(float hz); // 0.1..30
+float Settings_GetInputSmoothingMinCutoffHz();
+void Settings_SetInputSmoothingBeta(float beta);      // 0..50
+float Settings_GetInputSmoothingBeta();
+
+// Short-horizon prediction: push each moving key ahead by its travel velocity
+// times HorizonMs (after smoothing, before the curve). Off by default.
+void Settings_SetInputPrediction(bool on);
+bool Settings_GetInputPrediction();
+void Settings_SetInputPredictionHorizonMs(float ms); // 0.25..5
+float Settings_GetInputPredictionHorizonMs();
+
 // Apply current input deadzones to value in [0..1]
 float Settings_ApplyInputDeadzones(float v01);
 
@@ -61,7 +79,7 @@ UINT Settings_GetPollingMs();
 void Settings_SetUIRefreshMs(UINT ms); // 1..200
 UINT Settings_GetUIRefreshMs();
 
-// Number of virtual X360 gamepads to expose through ViGEm (1..4).
+// Number of virtual X360 gamepads to expose through ViGEm (1..BINDINGS_MAX_GAMEPADS).
 void Settings_SetVirtualGamepadCount(int count);
 int Settings_GetVirtualGamepadCount();
 void Settings_SetVirtualGamepadsEnabled(bool on);
@@ -90,6 +108,10 @@ bool Settings_GetBlockBoundKeys();
 void Settings_SetDigitalFallbackInput(bool on);
 bool Settings_GetDigitalFallbackInput();
 
+// Realtime watchdog: send neutral reports to all pads when the input thread stalls.
+void Settings_SetWatchdogNeutralizePads(bool on);
+bool Settings_GetWatchdogNeutralizePads();
+
 // Aula native HID communication strategy.
 enum SettingsAulaCommMode : UINT
 {
@@ -100,6 +122,25 @@ enum SettingsAulaCommMode : UINT
 void Settings_SetAulaCommMode(UINT mode);
 UINT Settings_GetAulaCommMode();
 
+// Per-pad report change detection: which built reports are handed to ViGEm.
+// Unchanged reports are always resent every 250 ms, changes at most every 4 ms.
+enum SettingsReportPolicy : UINT
+{
+    SettingsReportPolicy_Exact = 0,     // every change is sent
+    SettingsReportPolicy_Threshold = 1, // stick / trigger changes below the thresholds wait for keep-alive
+    SettingsReportPolicy_Adaptive = 2,  // like Threshold, but small changes are sent after FlushMs
+};
+static constexpr int SETTINGS_MAX_GAMEPADS = 8; // == BINDINGS_MAX_GAMEPADS
+
+void Settings_SetReportPolicy(int pad, UINT policy);
+UINT Settings_GetReportPolicy(int pad);
+void Settings_SetReportStickThreshold(int pad, int units);   // 1..8192 (stick range +-32767)
+int Settings_GetReportStickThreshold(int pad);
+void Settings_SetReportTriggerThreshold(int pad, int units); // 1..64 (trigger range 0..255)
+int Settings_GetReportTriggerThreshold(int pad);
+void Settings_SetReportFlushMs(int pad, UINT ms);            // 4..250 (not below the 4 ms send interval), Adaptive only
+UINT Settings_GetReportFlushMs(int pad);
+
 // Block physical mouse events when mouse->stick mode is active.
 void Settings_SetBlockMouseInput(bool on);
 bool Settings_GetBlockMouseInput();
@@ -159,3 +200,67 @@ int Settings_GetMainWindowPosXPx();
 
 void Settings_SetMainWindowPosYPx(int px);
 int Settings_GetMainWindowPosYPx();
+
+// ---------------- Realtime snapshot ----------------
+//
+// Consistent copy of everything the backend tick reads. Setters of these values
+// republish it; the tick loads it once so it never sees half of a UI change.
+struct SettingsSnapshot
+{
+    uint64_t version = 0; // bumped on every publish
+
+    // Global curve
+    bool inputInvert = false;
+    UINT inputCurveMode = 1;
+    float inputDeadzoneLow = 0.08f;
+    float inputDeadzoneHigh = 0.9f;
+    float inputAntiDeadzone = 0.0f;
+    float inputOutputCap = 1.0f;
+    float inputBezierCp1X = 0.38f;
+    float inputBezierCp1Y = 0.33f;
+    float inputBezierCp2X = 0.68f;
+    float inputBezierCp2Y = 0.66f;
+    float inputBezierCp1W = 1.0f;
+    float inputBezierCp2W = 1.0f;
+
+    // One Euro smoothing
+    bool inputSmoothing = false;
+    float inputSmoothingMinCutoffHz = 1.0f;
+    float inputSmoothingBeta = 2.0f;
+
+    // Travel prediction
+    bool inputPrediction = false;
+    float inputPredictionHorizonMs = 2.0f;
+
+    // Report change detection, per pad
+    struct ReportPolicy
+    {
+        uint8_t policy = SettingsReportPolicy_Adaptive;
+        uint8_t triggerThreshold = 2;
+        uint16_t stickThreshold = 256;
+        uint16_t flushMs = 10;
+    };
+    ReportPolicy reportPolicy[SETTINGS_MAX_GAMEPADS]{};
+
+    // Axis conflict modes
+    bool snappyJoystick = false;
+    bool lastKeyPriority = false;
+    float lastKeyPrioritySensitivity = 0.12f;
+
+    bool digitalFallbackInput = false;
+    bool blockBoundKeys = false;
+    bool blockMouseInput = false;
+    UINT pollingMs = 1;
+
+    // Mouse -> stick
+    bool mouseToStickEnabled = false;
+    int mouseToStickTarget = 1;
+    float mouseToStickSensitivity = 1.0f;
+    float mouseToStickAggressiveness = 1.0f;
+    float mouseToStickMaxOffset = 2.5f;
+    float mouseToStickFollowSpeed = 1.0f;
+};
+
+// Lock-free for readers (seqlock copy), safe from any thread.
+void Settings_GetSnapshot(SettingsSnapshot* out);
+uint64_t Settings_GetSnapshotVersion();
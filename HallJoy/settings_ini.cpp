@@ -14,8 +14,9 @@
 
 #include "settings_ini.h"
 #include "settings.h"
+#include "bindings.h"
 #include "key_settings.h"
-#include "ini_util.h"
+#include "ini_doc.h"
 #include "keyboard_layout.h"
 #include "global_profiles.h"
 
@@ -26,107 +27,26 @@ static float ClampF(float v, float lo, float hi)
     return v;
 }
 
-static void IniWriteFloat1000(const wchar_t* section, const wchar_t* key, float v, const wchar_t* path)
+static void IniWriteFloat1000(IniDoc& ini, const wchar_t* section, const wchar_t* key, float v)
 {
-    int iv = (int)lroundf(v * 1000.0f);
-    wchar_t buf[32]{};
-    swprintf_s(buf, L"%d", iv);
-    WritePrivateProfileStringW(section, key, buf, path);
+    ini.SetInt(section, key, (int)lroundf(v * 1000.0f));
 }
 
-static float IniReadFloat1000(const wchar_t* section, const wchar_t* key, float def, const wchar_t* path)
+static float IniReadFloat1000(const IniDoc& ini, const wchar_t* section, const wchar_t* key, float def)
 {
     int defI = (int)lroundf(def * 1000.0f);
-    int iv = GetPrivateProfileIntW(section, key, defI, path);
-    return (float)iv / 1000.0f;
+    return (float)ini.GetInt(section, key, defI) / 1000.0f;
 }
 
-static void IniWriteU32(const wchar_t* section, const wchar_t* key, UINT v, const wchar_t* path)
+static UINT IniReadU32(const IniDoc& ini, const wchar_t* section, const wchar_t* key, UINT def)
 {
-    wchar_t buf[32]{};
-    swprintf_s(buf, L"%u", (unsigned)v);
-    WritePrivateProfileStringW(section, key, buf, path);
+    return (UINT)ini.GetInt(section, key, (int)def);
 }
 
-static UINT IniReadU32(const wchar_t* section, const wchar_t* key, UINT def, const wchar_t* path)
-{
-    return (UINT)GetPrivateProfileIntW(section, key, (int)def, path);
-}
-
-static void IniWriteI32(const wchar_t* section, const wchar_t* key, int v, const wchar_t* path)
-{
-    wchar_t buf[32]{};
-    swprintf_s(buf, L"%d", v);
-    WritePrivateProfileStringW(section, key, buf, path);
-}
-
-static int IniReadI32(const wchar_t* section, const wchar_t* key, int def, const wchar_t* path)
-{
-    wchar_t buf[64]{};
-    GetPrivateProfileStringW(section, key, L"", buf, (DWORD)_countof(buf), path);
-    if (buf[0] == 0)
-        return def;
-    return _wtoi(buf);
-}
-
-static bool ReadSectionKeys(const wchar_t* section, const wchar_t* path, std::vector<std::wstring>& keysOut)
-{
-    keysOut.clear();
-    if (!section || !path) return false;
-
-    // GetPrivateProfileSectionW truncates output if buffer is too small.
-    // If truncated, return value is typically (cap - 2).
-    // We grow the buffer until it fits or we hit a sane limit.
-    DWORD cap = 64 * 1024;
-    const DWORD CAP_MAX = 4 * 1024 * 1024; // 4 MB safety cap
-
-    std::vector<wchar_t> buf;
-
-    for (;;)
-    {
-        buf.assign(cap, 0);
-
-        DWORD n = GetPrivateProfileSectionW(section, buf.data(), cap, path);
-        if (n == 0)
-        {
-            // section missing or empty
-            return false;
-        }
-
-        // If truncated, n will be close to cap-2 (no guaranteed contract, but this is the common behavior).
-        // Also ensure double-null termination exists.
-        bool likelyTruncated = (n >= cap - 2);
-
-        if (!likelyTruncated)
-        {
-            // parse normally
-            const wchar_t* p = buf.data();
-            while (*p)
-            {
-                const wchar_t* eq = wcschr(p, L'=');
-                if (eq && eq > p)
-                    keysOut.emplace_back(p, (size_t)(eq - p));
-
-                p += wcslen(p) + 1;
-            }
-            return true;
-        }
-
-        // grow buffer
-        if (cap >= CAP_MAX)
-        {
-            // still truncated at maximum size -> fail fast (better than silently losing settings)
-            return false;
-        }
-
-        cap = std::min<DWORD>(cap * 2, CAP_MAX);
-    }
-}
-
-static void KeySettingsIni_SaveToSettingsIni(const wchar_t* path)
+static void KeySettingsIni_SaveToSettingsIni(IniDoc& ini)
 {
     // rewrite the whole section
-    WritePrivateProfileStringW(L"KeyDeadzone", nullptr, nullptr, path);
+    ini.RemoveSection(L"KeyDeadzone");
 
     std::vector<std::pair<uint16_t, KeyDeadzone>> all;
     KeySettings_Enumerate(all);
@@ -140,6 +60,7 @@ static void KeySettingsIni_SaveToSettingsIni(const wchar_t* path)
         wchar_t kLow[64], kHigh[64], kADZ[64], kCap[64];
         wchar_t kC1X[64], kC1Y[64], kC2X[64], kC2Y[64];
         wchar_t kC1W[64], kC2W[64];
+        wchar_t kRT[64], kRTD[64], kPress[64], kRel[64];
 
         swprintf_s(kUse, L"%u_Use", (unsigned)hid);
         swprintf_s(kInv, L"%u_Inv", (unsigned)hid);
@@ -158,49 +79,70 @@ static void KeySettingsIni_SaveToSettingsIni(const wchar_t* path)
         swprintf_s(kC1W, L"%u_C1W", (unsigned)hid);
         swprintf_s(kC2W, L"%u_C2W", (unsigned)hid);
 
-        IniWriteI32(L"KeyDeadzone", kUse, ks.useUnique ? 1 : 0, path);
+        swprintf_s(kRT, L"%u_RT", (unsigned)hid);
+        swprintf_s(kRTD, L"%u_RTD", (unsigned)hid);
+        swprintf_s(kPress, L"%u_P", (unsigned)hid);
+        swprintf_s(kRel, L"%u_R", (unsigned)hid);
+
+        ini.SetInt(L"KeyDeadzone", kUse, ks.useUnique ? 1 : 0);
 
-        if (ks.invert) IniWriteI32(L"KeyDeadzone", kInv, 1, path);
-        if (ks.curveMode != 0) IniWriteI32(L"KeyDeadzone", kMode, (int)ks.curveMode, path);
+        if (ks.invert) ini.SetInt(L"KeyDeadzone", kInv, 1);
+        if (ks.curveMode != 0) ini.SetInt(L"KeyDeadzone", kMode, (int)ks.curveMode);
 
-        IniWriteI32(L"KeyDeadzone", kLow, (int)lroundf(ks.low * 1000.0f), path);
-        IniWriteI32(L"KeyDeadzone", kHigh, (int)lroundf(ks.high * 1000.0f), path);
+        ini.SetInt(L"KeyDeadzone", kLow, (int)lroundf(ks.low * 1000.0f));
+        ini.SetInt(L"KeyDeadzone", kHigh, (int)lroundf(ks.high * 1000.0f));
 
         if (ks.antiDeadzone > 0.001f)
-            IniWriteI32(L"KeyDeadzone", kADZ, (int)lroundf(ks.antiDeadzone * 1000.0f), path);
+            ini.SetInt(L"KeyDeadzone", kADZ, (int)lroundf(ks.antiDeadzone * 1000.0f));
 
         if (ks.outputCap < 0.999f)
-            IniWriteI32(L"KeyDeadzone", kCap, (int)lroundf(ks.outputCap * 1000.0f), path);
+            ini.SetInt(L"KeyDeadzone", kCap, (int)lroundf(ks.outputCap * 1000.0f));
 
-        IniWriteI32(L"KeyDeadzone", kC1X, (int)lroundf(ks.cp1_x * 1000.0f), path);
-        IniWriteI32(L"KeyDeadzone", kC1Y, (int)lroundf(ks.cp1_y * 1000.0f), path);
-        IniWriteI32(L"KeyDeadzone", kC2X, (int)lroundf(ks.cp2_x * 1000.0f), path);
-        IniWriteI32(L"KeyDeadzone", kC2Y, (int)lroundf(ks.cp2_y * 1000.0f), path);
+        ini.SetInt(L"KeyDeadzone", kC1X, (int)lroundf(ks.cp1_x * 1000.0f));
+        ini.SetInt(L"KeyDeadzone", kC1Y, (int)lroundf(ks.cp1_y * 1000.0f));
+        ini.SetInt(L"KeyDeadzone", kC2X, (int)lroundf(ks.cp2_x * 1000.0f));
+        ini.SetInt(L"KeyDeadzone", kC2Y, (int)lroundf(ks.cp2_y * 1000.0f));
 
         float w1 = ClampF(ks.cp1_w, 0.0f, 1.0f);
         float w2 = ClampF(ks.cp2_w, 0.0f, 1.0f);
-        IniWriteI32(L"KeyDeadzone", kC1W, (int)lroundf(w1 * 1000.0f), path);
-        IniWriteI32(L"KeyDeadzone", kC2W, (int)lroundf(w2 * 1000.0f), path);
+        ini.SetInt(L"KeyDeadzone", kC1W, (int)lroundf(w1 * 1000.0f));
+        ini.SetInt(L"KeyDeadzone", kC2W, (int)lroundf(w2 * 1000.0f));
+
+        // Rapid trigger: 1 = on the curve output, 2 = on the raw value.
+        if (ks.digital.rapidTrigger)
+        {
+            ini.SetInt(L"KeyDeadzone", kRT, ks.digital.rtRaw ? 2 : 1);
+            ini.SetInt(L"KeyDeadzone", kRTD, (int)lroundf(ks.digital.rtDelta * 1000.0f));
+        }
+
+        // Button actuation (press / release points), only when not the default.
+        const KeyDigital digDef{};
+        if (lroundf(ks.digital.pressPoint * 1000.0f) != lroundf(digDef.pressPoint * 1000.0f) ||
+            lroundf(ks.digital.releasePoint * 1000.0f) != lroundf(digDef.releasePoint * 1000.0f))
+        {
+            ini.SetInt(L"KeyDeadzone", kPress, (int)lroundf(ks.digital.pressPoint * 1000.0f));
+            ini.SetInt(L"KeyDeadzone", kRel, (int)lroundf(ks.digital.releasePoint * 1000.0f));
+        }
     }
 }
 
-static void KeySettingsIni_LoadFromSettingsIni(const wchar_t* path)
+static void KeySettingsIni_LoadFromSettingsIni(const IniDoc& ini)
 {
     KeySettings_ClearAll();
 
-    std::vector<std::wstring> keys;
-    if (!ReadSectionKeys(L"KeyDeadzone", path, keys)) return;
+    const std::vector<IniDoc::Entry>* entries = ini.Section(L"KeyDeadzone");
+    if (!entries || entries->empty()) return;
 
-    std::unordered_set<uint16_t> hids;
-    hids.reserve(keys.size());
+    // Keys come grouped per HID; keep first-seen order and dedupe.
+    std::vector<uint16_t> hids;
+    std::unordered_set<uint16_t> seen;
+    seen.reserve(entries->size() / 8 + 1);
 
-    for (const auto& k : keys)
+    for (const auto& e : *entries)
     {
-        size_t us = k.find(L'_');
-        std::wstring prefix = (us == std::wstring::npos) ? k : k.substr(0, us);
-        int hidI = _wtoi(prefix.c_str());
-        if (hidI > 0 && hidI <= 65535)
-            hids.insert((uint16_t)hidI);
+        int hidI = _wtoi(e.key.c_str());
+        if (hidI > 0 && hidI <= 65535 && seen.insert((uint16_t)hidI).second)
+            hids.push_back((uint16_t)hidI);
     }
 
     for (uint16_t hid : hids)
@@ -209,6 +151,7 @@ static void KeySettingsIni_LoadFromSettingsIni(const wchar_t* path)
         wchar_t kLow[64], kHigh[64], kADZ[64], kCap[64];
         wchar_t kC1X[64], kC1Y[64], kC2X[64], kC2Y[64];
         wchar_t kC1W[64], kC2W[64];
+        wchar_t kRT[64], kRTD[64], kPress[64], kRel[64];
 
         swprintf_s(kUse, L"%u_Use", (unsigned)hid);
         swprintf_s(kInv, L"%u_Inv", (unsigned)hid);
@@ -227,24 +170,33 @@ static void KeySettingsIni_LoadFromSettingsIni(const wchar_t* path)
         swprintf_s(kC1W, L"%u_C1W", (unsigned)hid);
         swprintf_s(kC2W, L"%u_C2W", (unsigned)hid);
 
-        int use = GetPrivateProfileIntW(L"KeyDeadzone", kUse, 0, path);
-        int inv = GetPrivateProfileIntW(L"KeyDeadzone", kInv, 0, path);
-        int mode = GetPrivateProfileIntW(L"KeyDeadzone", kMode, 0, path);
+        swprintf_s(kRT, L"%u_RT", (unsigned)hid);
+        swprintf_s(kRTD, L"%u_RTD", (unsigned)hid);
+        swprintf_s(kPress, L"%u_P", (unsigned)hid);
+        swprintf_s(kRel, L"%u_R", (unsigned)hid);
+
+        int use = ini.GetInt(L"KeyDeadzone", kUse, 0);
+        int inv = ini.GetInt(L"KeyDeadzone", kInv, 0);
+        int mode = ini.GetInt(L"KeyDeadzone", kMode, 0);
 
-        int lowM = GetPrivateProfileIntW(L"KeyDeadzone", kLow, 80, path);
-        int higM = GetPrivateProfileIntW(L"KeyDeadzone", kHigh, 900, path);
+        int lowM = ini.GetInt(L"KeyDeadzone", kLow, 80);
+        int higM = ini.GetInt(L"KeyDeadzone", kHigh, 900);
 
-        int adzM = GetPrivateProfileIntW(L"KeyDeadzone", kADZ, 0, path);
-        int capM = GetPrivateProfileIntW(L"KeyDeadzone", kCap, 1000, path);
+        int adzM = ini.GetInt(L"KeyDeadzone", kADZ, 0);
+        int capM = ini.GetInt(L"KeyDeadzone", kCap, 1000);
 
-        int c1x = GetPrivateProfileIntW(L"KeyDeadzone", kC1X, 380, path);
-        int c1y = GetPrivateProfileIntW(L"KeyDeadzone", kC1Y, 330, path);
-        int c2x = GetPrivateProfileIntW(L"KeyDeadzone", kC2X, 680, path);
-        int c2y = GetPrivateProfileIntW(L"KeyDeadzone", kC2Y, 660, path);
+        int c1x = ini.GetInt(L"KeyDeadzone", kC1X, 380);
+        int c1y = ini.GetInt(L"KeyDeadzone", kC1Y, 330);
+        int c2x = ini.GetInt(L"KeyDeadzone", kC2X, 680);
+        int c2y = ini.GetInt(L"KeyDeadzone", kC2Y, 660);
 
-        int c1w = GetPrivateProfileIntW(L"KeyDeadzone", kC1W, 1000, path);
-        int c2w = GetPrivateProfileIntW(L"KeyDeadzone", kC2W, 1000, path);
+        int c1w = ini.GetInt(L"KeyDeadzone", kC1W, 1000);
+        int c2w = ini.GetInt(L"KeyDeadzone", kC2W, 1000);
 
+        int rt = ini.GetInt(L"KeyDeadzone", kRT, 0);
+        int rtdM = ini.GetInt(L"KeyDeadzone", kRTD, 50);
+        int pressM = ini.GetInt(L"KeyDeadzone", kPress, 100);
+        int relM = ini.GetInt(L"KeyDeadzone", kRel, 80);
         KeyDeadzone ks;
         ks.useUnique = (use != 0);
         ks.invert = (inv != 0);
@@ -263,16 +215,73 @@ static void KeySettingsIni_LoadFromSettingsIni(const wchar_t* path)
         ks.cp1_w = ClampF((float)c1w / 1000.0f, 0.0f, 1.0f);
         ks.cp2_w = ClampF((float)c2w / 1000.0f, 0.0f, 1.0f);
 
+        ks.digital.rapidTrigger = (rt != 0);
+        ks.digital.rtRaw = (rt == 2);
+        ks.digital.rtDelta = (float)rtdM / 1000.0f;
+        ks.digital.pressPoint = (float)pressM / 1000.0f;
+        ks.digital.releasePoint = (float)relM / 1000.0f;
+
         KeySettings_Set(hid, ks);
     }
 }
 
-static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loadLayout, bool loadActiveProfileKey)
+// [Reports] PadN* keys (N = 1..8); only pads that differ from the defaults are written.
+static void ReportPolicyIni_Save(IniDoc& ini)
 {
-    if (!path) return false;
+    ini.RemoveSection(L"Reports");
+
+    const SettingsSnapshot::ReportPolicy def{};
+    for (int pad = 0; pad < SETTINGS_MAX_GAMEPADS; ++pad)
+    {
+        UINT policy = Settings_GetReportPolicy(pad);
+        int stick = Settings_GetReportStickThreshold(pad);
+        int trig = Settings_GetReportTriggerThreshold(pad);
+        UINT flush = Settings_GetReportFlushMs(pad);
+        if (policy == def.policy && stick == def.stickThreshold &&
+            trig == def.triggerThreshold && flush == def.flushMs)
+            continue;
+
+        wchar_t k[64];
+        swprintf_s(k, L"Pad%dPolicy", pad + 1);
+        ini.SetUInt(L"Reports", k, policy);
+        swprintf_s(k, L"Pad%dStickThreshold", pad + 1);
+        ini.SetInt(L"Reports", k, stick);
+        swprintf_s(k, L"Pad%dTriggerThreshold", pad + 1);
+        ini.SetInt(L"Reports", k, trig);
+        swprintf_s(k, L"Pad%dFlushMs", pad + 1);
+        ini.SetUInt(L"Reports", k, flush);
+    }
+}
+
+// Missing keys fall back to the defaults, never to the previous profile.
+static void ReportPolicyIni_Load(const IniDoc& ini)
+{
+    const SettingsSnapshot::ReportPolicy def{};
+    for (int pad = 0; pad < SETTINGS_MAX_GAMEPADS; ++pad)
+    {
+        wchar_t k[64];
+        swprintf_s(k, L"Pad%dPolicy", pad + 1);
+        UINT policy = IniReadU32(ini, L"Reports", k, def.policy);
+        swprintf_s(k, L"Pad%dStickThreshold", pad + 1);
+        int stick = ini.GetInt(L"Reports", k, def.stickThreshold);
+        swprintf_s(k, L"Pad%dTriggerThreshold", pad + 1);
+        int trig = ini.GetInt(L"Reports", k, def.triggerThreshold);
+        swprintf_s(k, L"Pad%dFlushMs", pad + 1);
+        UINT flush = IniReadU32(ini, L"Reports", k, def.flushMs);
+
+        Settings_SetReportPolicy(pad, policy);
+        Settings_SetReportStickThreshold(pad, stick);
+        Settings_SetReportTriggerThreshold(pad, trig);
+        Settings_SetReportFlushMs(pad, flush);
+    }
+}
 
-    DWORD attr = GetFileAttributesW(path);
-    if (attr == INVALID_FILE_ATTRIBUTES) return false;
+static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loadLayout, bool loadActiveProfileKey)
+{
+    // One read + parse; every lookup below is a hash probe instead of a
+    // GetPrivateProfile* call that rescans the file.
+    IniDoc ini;
+    if (!ini.Load(path)) return false;
 
     const bool profileOnly = (!loadWindow && !loadLayout && !loadActiveProfileKey);
 
@@ -300,6 +309,7 @@ static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loa
     int padsDef = profileOnly ? 1 : Settings_GetVirtualGamepadCount();
     int padsEnabledDef = profileOnly ? 1 : (Settings_GetVirtualGamepadsEnabled() ? 1 : 0);
     int fallbackDef = profileOnly ? 0 : (Settings_GetDigitalFallbackInput() ? 1 : 0);
+    int watchdogNeutralizeDef = profileOnly ? 1 : (Settings_GetWatchdogNeutralizePads() ? 1 : 0);
     UINT vendorProtocolModeDef = profileOnly ? (UINT)SettingsAulaCommMode_94Passive : Settings_GetAulaCommMode();
     int mouseToStickEnabledDef = profileOnly ? 0 : (Settings_GetMouseToStickEnabled() ? 1 : 0);
     int mouseToStickTargetDef = profileOnly ? 1 : Settings_GetMouseToStickTarget();
@@ -307,54 +317,65 @@ static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loa
     float mouseToStickAggDef = profileOnly ? 1.0f : Settings_GetMouseToStickAggressiveness();
     float mouseToStickMaxOffsetDef = profileOnly ? 2.5f : Settings_GetMouseToStickMaxOffset();
     float mouseToStickFollowSpeedDef = profileOnly ? 1.0f : Settings_GetMouseToStickFollowSpeed();
-
-    float low = IniReadFloat1000(L"Input", L"DeadzoneLow", lowDef, path);
-    float high = IniReadFloat1000(L"Input", L"DeadzoneHigh", highDef, path);
-
-    float adz = IniReadFloat1000(L"Input", L"AntiDeadzone", adzDef, path);
-    float cap = IniReadFloat1000(L"Input", L"OutputCap", capDef, path);
-
-    float c1x = IniReadFloat1000(L"Input", L"Cp1X", c1xDef, path);
-    float c1y = IniReadFloat1000(L"Input", L"Cp1Y", c1yDef, path);
-    float c2x = IniReadFloat1000(L"Input", L"Cp2X", c2xDef, path);
-    float c2y = IniReadFloat1000(L"Input", L"Cp2Y", c2yDef, path);
-
-    float c1w = IniReadFloat1000(L"Input", L"Cp1W", c1wDef, path);
-    float c2w = IniReadFloat1000(L"Input", L"Cp2W", c2wDef, path);
-
-    UINT curveMode = IniReadU32(L"Input", L"CurveMode", curveModeDef, path);
-    int invert = GetPrivateProfileIntW(L"Input", L"Invert", invertDef, path);
-    int snappy = GetPrivateProfileIntW(L"Input", L"SnappyJoystick", snappyDef, path);
-    int lastKeyPriority = GetPrivateProfileIntW(L"Input", L"LastKeyPriority", lkpDef, path);
+    int smoothingDef = profileOnly ? 0 : (Settings_GetInputSmoothing() ? 1 : 0);
+    float smoothingCutoffDef = profileOnly ? 1.0f : Settings_GetInputSmoothingMinCutoffHz();
+    float smoothingBetaDef = profileOnly ? 2.0f : Settings_GetInputSmoothingBeta();
+    int predictionDef = profileOnly ? 0 : (Settings_GetInputPrediction() ? 1 : 0);
+    float predictionHorizonDef = profileOnly ? 2.0f : Settings_GetInputPredictionHorizonMs();
+
+    float low = IniReadFloat1000(ini, L"Input", L"DeadzoneLow", lowDef);
+    float high = IniReadFloat1000(ini, L"Input", L"DeadzoneHigh", highDef);
+
+    float adz = IniReadFloat1000(ini, L"Input", L"AntiDeadzone", adzDef);
+    float cap = IniReadFloat1000(ini, L"Input", L"OutputCap", capDef);
+
+    float c1x = IniReadFloat1000(ini, L"Input", L"Cp1X", c1xDef);
+    float c1y = IniReadFloat1000(ini, L"Input", L"Cp1Y", c1yDef);
+    float c2x = IniReadFloat1000(ini, L"Input", L"Cp2X", c2xDef);
+    float c2y = IniReadFloat1000(ini, L"Input", L"Cp2Y", c2yDef);
+
+    float c1w = IniReadFloat1000(ini, L"Input", L"Cp1W", c1wDef);
+    float c2w = IniReadFloat1000(ini, L"Input", L"Cp2W", c2wDef);
+
+    UINT curveMode = IniReadU32(ini, L"Input", L"CurveMode", curveModeDef);
+    int invert = ini.GetInt(L"Input", L"Invert", invertDef);
+    int snappy = ini.GetInt(L"Input", L"SnappyJoystick", snappyDef);
+    int lastKeyPriority = ini.GetInt(L"Input", L"LastKeyPriority", lkpDef);
     float lastKeyPrioritySensitivity = IniReadFloat1000(
-        L"Input", L"LastKeyPrioritySensitivity",
-        lkpSensDef, path);
-    int blockBoundKeys = GetPrivateProfileIntW(L"Input", L"BlockBoundKeys", blockDef, path);
-    int blockMouseInput = GetPrivateProfileIntW(L"Input", L"BlockMouseInput", blockMouseDef, path);
-
-    UINT poll = IniReadU32(L"Main", L"PollingMs", pollDef, path);
-    UINT uiMs = IniReadU32(L"Main", L"UIRefreshMs", uiDef, path);
-    int vpadCount = GetPrivateProfileIntW(L"Main", L"VirtualGamepads", padsDef, path);
-    int vpadEnabled = GetPrivateProfileIntW(L"Main", L"VirtualGamepadsEnabled", padsEnabledDef, path);
-    int digitalFallbackInput = GetPrivateProfileIntW(L"Main", L"DigitalFallbackInput", fallbackDef, path);
-    UINT vendorProtocolMode = IniReadU32(L"Main", L"AulaCommMode", vendorProtocolModeDef, path);
-    vendorProtocolMode = IniReadU32(L"Main", L"VendorProtocolMode", vendorProtocolMode, path);
-    int mouseToStickEnabled = GetPrivateProfileIntW(L"Main", L"MouseToStickEnabled", mouseToStickEnabledDef, path);
-    int mouseToStickTarget = GetPrivateProfileIntW(L"Main", L"MouseToStickTarget", mouseToStickTargetDef, path);
-    float mouseToStickSensitivity = IniReadFloat1000(L"Main", L"MouseToStickSensitivity", mouseToStickSensDef, path);
-    float mouseToStickAggressiveness = IniReadFloat1000(L"Main", L"MouseToStickAggressiveness", mouseToStickAggDef, path);
-    float mouseToStickMaxOffset = IniReadFloat1000(L"Main", L"MouseToStickMaxOffset", mouseToStickMaxOffsetDef, path);
-    float mouseToStickFollowSpeed = IniReadFloat1000(L"Main", L"MouseToStickFollowSpeed", mouseToStickFollowSpeedDef, path);
+        ini, L"Input", L"LastKeyPrioritySensitivity",
+        lkpSensDef);
+    int blockBoundKeys = ini.GetInt(L"Input", L"BlockBoundKeys", blockDef);
+    int blockMouseInput = ini.GetInt(L"Input", L"BlockMouseInput", blockMouseDef);
+    int smoothing = ini.GetInt(L"Input", L"Smoothing", smoothingDef);
+    float smoothingCutoff = IniReadFloat1000(ini, L"Input", L"SmoothingMinCutoff", smoothingCutoffDef);
+    float smoothingBeta = IniReadFloat1000(ini, L"Input", L"SmoothingBeta", smoothingBetaDef);
+    int prediction = ini.GetInt(L"Input", L"Prediction", predictionDef);
+    float predictionHorizon = IniReadFloat1000(ini, L"Input", L"PredictionHorizonMs", predictionHorizonDef);
+
+    UINT poll = IniReadU32(ini, L"Main", L"PollingMs", pollDef);
+    UINT uiMs = IniReadU32(ini, L"Main", L"UIRefreshMs", uiDef);
+    int vpadCount = ini.GetInt(L"Main", L"VirtualGamepads", padsDef);
+    int vpadEnabled = ini.GetInt(L"Main", L"VirtualGamepadsEnabled", padsEnabledDef);
+    int digitalFallbackInput = ini.GetInt(L"Main", L"DigitalFallbackInput", fallbackDef);
+    int watchdogNeutralize = ini.GetInt(L"Main", L"WatchdogNeutralizePads", watchdogNeutralizeDef);
+    UINT vendorProtocolMode = IniReadU32(ini, L"Main", L"AulaCommMode", vendorProtocolModeDef);
+    vendorProtocolMode = IniReadU32(ini, L"Main", L"VendorProtocolMode", vendorProtocolMode);
+    int mouseToStickEnabled = ini.GetInt(L"Main", L"MouseToStickEnabled", mouseToStickEnabledDef);
+    int mouseToStickTarget = ini.GetInt(L"Main", L"MouseToStickTarget", mouseToStickTargetDef);
+    float mouseToStickSensitivity = IniReadFloat1000(ini, L"Main", L"MouseToStickSensitivity", mouseToStickSensDef);
+    float mouseToStickAggressiveness = IniReadFloat1000(ini, L"Main", L"MouseToStickAggressiveness", mouseToStickAggDef);
+    float mouseToStickMaxOffset = IniReadFloat1000(ini, L"Main", L"MouseToStickMaxOffset", mouseToStickMaxOffsetDef);
+    float mouseToStickFollowSpeed = IniReadFloat1000(ini, L"Main", L"MouseToStickFollowSpeed", mouseToStickFollowSpeedDef);
     int winW = Settings_GetMainWindowWidthPx();
     int winH = Settings_GetMainWindowHeightPx();
     int winX = std::numeric_limits<int>::min();
     int winY = std::numeric_limits<int>::min();
     if (loadWindow)
     {
-        winW = GetPrivateProfileIntW(L"Window", L"Width", Settings_GetMainWindowWidthPx(), path);
-        winH = GetPrivateProfileIntW(L"Window", L"Height", Settings_GetMainWindowHeightPx(), path);
-        winX = IniReadI32(L"Window", L"PosX", std::numeric_limits<int>::min(), path);
-        winY = IniReadI32(L"Window", L"PosY", std::numeric_limits<int>::min(), path);
+        winW = ini.GetInt(L"Window", L"Width", Settings_GetMainWindowWidthPx());
+        winH = ini.GetInt(L"Window", L"Height", Settings_GetMainWindowHeightPx());
+        winX = ini.GetInt(L"Window", L"PosX", std::numeric_limits<int>::min());
+        winY = ini.GetInt(L"Window", L"PosY", std::numeric_limits<int>::min());
     }
 
     Settings_SetInputDeadzoneLow(low);
@@ -378,12 +399,18 @@ static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loa
     Settings_SetLastKeyPrioritySensitivity(lastKeyPrioritySensitivity);
     Settings_SetBlockBoundKeys(blockBoundKeys != 0);
     Settings_SetBlockMouseInput(blockMouseInput != 0);
+    Settings_SetInputSmoothingMinCutoffHz(smoothingCutoff);
+    Settings_SetInputSmoothingBeta(smoothingBeta);
+    Settings_SetInputSmoothing(smoothing != 0);
+    Settings_SetInputPredictionHorizonMs(predictionHorizon);
+    Settings_SetInputPrediction(prediction != 0);
 
     Settings_SetPollingMs(poll);
     Settings_SetUIRefreshMs(uiMs);
     Settings_SetVirtualGamepadCount(vpadCount);
     Settings_SetVirtualGamepadsEnabled(vpadEnabled != 0);
     Settings_SetDigitalFallbackInput(digitalFallbackInput != 0);
+    Settings_SetWatchdogNeutralizePads(watchdogNeutralize != 0);
     Settings_SetAulaCommMode(vendorProtocolMode);
     Settings_SetMouseToStickEnabled(mouseToStickEnabled != 0);
     Settings_SetMouseToStickTarget(mouseToStickTarget);
@@ -400,11 +427,12 @@ static bool SettingsIni_Load_Core(const wchar_t* path, bool loadWindow, bool loa
     }
 
     if (loadActiveProfileKey)
-        GlobalProfiles_InitFromSettingsIni(path);
+        GlobalProfiles_InitFromSettingsIni(ini);
 
-    KeySettingsIni_LoadFromSettingsIni(path);
+    ReportPolicyIni_Load(ini);
+    KeySettingsIni_LoadFromSettingsIni(ini);
     if (loadLayout)
-        KeyboardLayout_LoadFromIni(path);
+        KeyboardLayout_LoadFromIni(ini);
     return true;
 }
 
@@ -420,98 +448,210 @@ bool SettingsIni_LoadProfile(const wchar_t* path)
 
 // Writes ONLY application settings (settings.ini).
 // Curve presets are stored separately by KeyboardProfiles (CurvePresets folder).
-static bool SettingsIni_Save_Internal(const wchar_t* tmpPath, bool saveWindow, bool saveLayout, bool saveActiveProfileKey)
+static void SettingsIni_Save_Internal(IniDoc& ini, bool saveWindow, bool saveLayout, bool saveActiveProfileKey)
 {
-    if (!tmpPath) return false;
-
-    IniWriteFloat1000(L"Input", L"DeadzoneLow", Settings_GetInputDeadzoneLow(), tmpPath);
-    IniWriteFloat1000(L"Input", L"DeadzoneHigh", Settings_GetInputDeadzoneHigh(), tmpPath);
-
-    IniWriteFloat1000(L"Input", L"AntiDeadzone", Settings_GetInputAntiDeadzone(), tmpPath);
-    IniWriteFloat1000(L"Input", L"OutputCap", Settings_GetInputOutputCap(), tmpPath);
-
-    IniWriteFloat1000(L"Input", L"Cp1X", Settings_GetInputBezierCp1X(), tmpPath);
-    IniWriteFloat1000(L"Input", L"Cp1Y", Settings_GetInputBezierCp1Y(), tmpPath);
-    IniWriteFloat1000(L"Input", L"Cp2X", Settings_GetInputBezierCp2X(), tmpPath);
-    IniWriteFloat1000(L"Input", L"Cp2Y", Settings_GetInputBezierCp2Y(), tmpPath);
-
-    IniWriteFloat1000(L"Input", L"Cp1W", Settings_GetInputBezierCp1W(), tmpPath);
-    IniWriteFloat1000(L"Input", L"Cp2W", Settings_GetInputBezierCp2W(), tmpPath);
-
-    IniWriteU32(L"Input", L"CurveMode", Settings_GetInputCurveMode(), tmpPath);
-    IniWriteI32(L"Input", L"Invert", Settings_GetInputInvert() ? 1 : 0, tmpPath);
-    IniWriteI32(L"Input", L"SnappyJoystick", Settings_GetSnappyJoystick() ? 1 : 0, tmpPath);
-    IniWriteI32(L"Input", L"LastKeyPriority", Settings_GetLastKeyPriority() ? 1 : 0, tmpPath);
-    IniWriteFloat1000(L"Input", L"LastKeyPrioritySensitivity", Settings_GetLastKeyPrioritySensitivity(), tmpPath);
-    IniWriteI32(L"Input", L"BlockBoundKeys", Settings_GetBlockBoundKeys() ? 1 : 0, tmpPath);
-    IniWriteI32(L"Input", L"BlockMouseInput", Settings_GetBlockMouseInput() ? 1 : 0, tmpPath);
-
-    IniWriteU32(L"Main", L"PollingMs", Settings_GetPollingMs(), tmpPath);
-    IniWriteU32(L"Main", L"UIRefreshMs", Settings_GetUIRefreshMs(), tmpPath);
-    IniWriteI32(L"Main", L"VirtualGamepads", std::clamp(Settings_GetVirtualGamepadCount(), 1, 4), tmpPath);
-    IniWriteI32(L"Main", L"VirtualGamepadsEnabled", Settings_GetVirtualGamepadsEnabled() ? 1 : 0, tmpPath);
-    IniWriteI32(L"Main", L"DigitalFallbackInput", Settings_GetDigitalFallbackInput() ? 1 : 0, tmpPath);
-    IniWriteU32(L"Main", L"VendorProtocolMode", Settings_GetAulaCommMode(), tmpPath);
-    WritePrivateProfileStringW(L"Main", L"AulaCommMode", nullptr, tmpPath);
-    IniWriteI32(L"Main", L"MouseToStickEnabled", Settings_GetMouseToStickEnabled() ? 1 : 0, tmpPath);
-    IniWriteI32(L"Main", L"MouseToStickTarget", Settings_GetMouseToStickTarget(), tmpPath);
-    IniWriteFloat1000(L"Main", L"MouseToStickSensitivity", Settings_GetMouseToStickSensitivity(), tmpPath);
-    IniWriteFloat1000(L"Main", L"MouseToStickAggressiveness", Settings_GetMouseToStickAggressiveness(), tmpPath);
-    IniWriteFloat1000(L"Main", L"MouseToStickMaxOffset", Settings_GetMouseToStickMaxOffset(), tmpPath);
-    IniWriteFloat1000(L"Main", L"MouseToStickFollowSpeed", Settings_GetMouseToStickFollowSpeed(), tmpPath);
+    IniWriteFloat1000(ini, L"Input", L"DeadzoneLow", Settings_GetInputDeadzoneLow());
+    IniWriteFloat1000(ini, L"Input", L"DeadzoneHigh", Settings_GetInputDeadzoneHigh());
+
+    IniWriteFloat1000(ini, L"Input", L"AntiDeadzone", Settings_GetInputAntiDeadzone());
+    IniWriteFloat1000(ini, L"Input", L"OutputCap", Settings_GetInputOutputCap());
+
+    IniWriteFloat1000(ini, L"Input", L"Cp1X", Settings_GetInputBezierCp1X());
+    IniWriteFloat1000(ini, L"Input", L"Cp1Y", Settings_GetInputBezierCp1Y());
+    IniWriteFloat1000(ini, L"Input", L"Cp2X", Settings_GetInputBezierCp2X());
+    IniWriteFloat1000(ini, L"Input", L"Cp2Y", Settings_GetInputBezierCp2Y());
+
+    IniWriteFloat1000(ini, L"Input", L"Cp1W", Settings_GetInputBezierCp1W());
+    IniWriteFloat1000(ini, L"Input", L"Cp2W", Settings_GetInputBezierCp2W());
+
+    ini.SetUInt(L"Input", L"CurveMode", Settings_GetInputCurveMode());
+    ini.SetInt(L"Input", L"Invert", Settings_GetInputInvert() ? 1 : 0);
+    ini.SetInt(L"Input", L"SnappyJoystick", Settings_GetSnappyJoystick() ? 1 : 0);
+    ini.SetInt(L"Input", L"LastKeyPriority", Settings_GetLastKeyPriority() ? 1 : 0);
+    IniWriteFloat1000(ini, L"Input", L"LastKeyPrioritySensitivity", Settings_GetLastKeyPrioritySensitivity());
+    ini.SetInt(L"Input", L"BlockBoundKeys", Settings_GetBlockBoundKeys() ? 1 : 0);
+    ini.SetInt(L"Input", L"BlockMouseInput", Settings_GetBlockMouseInput() ? 1 : 0);
+    ini.SetInt(L"Input", L"Smoothing", Settings_GetInputSmoothing() ? 1 : 0);
+    IniWriteFloat1000(ini, L"Input", L"SmoothingMinCutoff", Settings_GetInputSmoothingMinCutoffHz());
+    IniWriteFloat1000(ini, L"Input", L"SmoothingBeta", Settings_GetInputSmoothingBeta());
+    ini.SetInt(L"Input", L"Prediction", Settings_GetInputPrediction() ? 1 : 0);
+    IniWriteFloat1000(ini, L"Input", L"PredictionHorizonMs", Settings_GetInputPredictionHorizonMs());
+
+    ini.SetUInt(L"Main", L"PollingMs", Settings_GetPollingMs());
+    ini.SetUInt(L"Main", L"UIRefreshMs", Settings_GetUIRefreshMs());
+    ini.SetInt(L"Main", L"VirtualGamepads", std::clamp(Settings_GetVirtualGamepadCount(), 1, BINDINGS_MAX_GAMEPADS));
+    ini.SetInt(L"Main", L"VirtualGamepadsEnabled", Settings_GetVirtualGamepadsEnabled() ? 1 : 0);
+    ini.SetInt(L"Main", L"DigitalFallbackInput", Settings_GetDigitalFallbackInput() ? 1 : 0);
+    ini.SetInt(L"Main", L"WatchdogNeutralizePads", Settings_GetWatchdogNeutralizePads() ? 1 : 0);
+    ini.SetUInt(L"Main", L"VendorProtocolMode", Settings_GetAulaCommMode());
+    ini.RemoveKey(L"Main", L"AulaCommMode");
+    ini.SetInt(L"Main", L"MouseToStickEnabled", Settings_GetMouseToStickEnabled() ? 1 : 0);
+    ini.SetInt(L"Main", L"MouseToStickTarget", Settings_GetMouseToStickTarget());
+    IniWriteFloat1000(ini, L"Main", L"MouseToStickSensitivity", Settings_GetMouseToStickSensitivity());
+    IniWriteFloat1000(ini, L"Main", L"MouseToStickAggressiveness", Settings_GetMouseToStickAggressiveness());
+    IniWriteFloat1000(ini, L"Main", L"MouseToStickMaxOffset", Settings_GetMouseToStickMaxOffset());
+    IniWriteFloat1000(ini, L"Main", L"MouseToStickFollowSpeed", Settings_GetMouseToStickFollowSpeed());
     if (saveActiveProfileKey)
-        WritePrivateProfileStringW(L"Main", L"ActiveGlobalProfile", GlobalProfiles_GetActiveName().c_str(), tmpPath);
+    {
+        ini.SetString(L"Main", L"ActiveGlobalProfile", GlobalProfiles_GetStartupName().c_str());
+        // This doc may be written after a later marker-only write; make the next
+        // profile save rewrite the marker instead of trusting its cache.
+        GlobalProfiles_ResetMarkerCache();
+    }
 
     if (saveWindow)
     {
-        IniWriteI32(L"Window", L"Width", std::max(0, Settings_GetMainWindowWidthPx()), tmpPath);
-        IniWriteI32(L"Window", L"Height", std::max(0, Settings_GetMainWindowHeightPx()), tmpPath);
+        ini.SetInt(L"Window", L"Width", std::max(0, Settings_GetMainWindowWidthPx()));
+        ini.SetInt(L"Window", L"Height", std::max(0, Settings_GetMainWindowHeightPx()));
         const int winX = Settings_GetMainWindowPosXPx();
         const int winY = Settings_GetMainWindowPosYPx();
         if (winX == std::numeric_limits<int>::min())
-            WritePrivateProfileStringW(L"Window", L"PosX", nullptr, tmpPath);
+            ini.RemoveKey(L"Window", L"PosX");
         else
-            IniWriteI32(L"Window", L"PosX", winX, tmpPath);
+            ini.SetInt(L"Window", L"PosX", winX);
         if (winY == std::numeric_limits<int>::min())
-            WritePrivateProfileStringW(L"Window", L"PosY", nullptr, tmpPath);
+            ini.RemoveKey(L"Window", L"PosY");
         else
-            IniWriteI32(L"Window", L"PosY", winY, tmpPath);
+            ini.SetInt(L"Window", L"PosY", winY);
     }
 
-    KeySettingsIni_SaveToSettingsIni(tmpPath);
+    ReportPolicyIni_Save(ini);
+    KeySettingsIni_SaveToSettingsIni(ini);
     if (saveLayout)
-        KeyboardLayout_SaveToIni(tmpPath);
-    return true;
+        KeyboardLayout_SaveToIni(ini);
 }
 
 bool SettingsIni_Save(const wchar_t* path)
 {
     if (!path) return false;
 
-    std::wstring tmp = std::wstring(path) + L".tmp";
-    DeleteFileW(tmp.c_str());
+    IniDoc ini;
+    SettingsIni_Save_Internal(ini, true, true, true);
+    return ini.Save(path);
+}
 
-    if (!SettingsIni_Save_Internal(tmp.c_str(), true, true, true))
-    {
-        DeleteFileW(tmp.c_str());
-        return false;
-    }
+void SettingsIni_BuildDoc(IniDoc& out)
+{
+    out.Clear();
+    SettingsIni_Save_Internal(out, true, true, true);
+}
 
-    return IniUtil_AtomicReplace(tmp.c_str(), path);
+void SettingsIni_BuildProfileDoc(IniDoc& out)
+{
+    out.Clear();
+    SettingsIni_Save_Internal(out, false, false, false);
 }
 
 bool SettingsIni_SaveProfile(const wchar_t* path)
 {
     if (!path) return false;
 
-    std::wstring tmp = std::wstring(path) + L".tmp";
-    DeleteFileW(tmp.c_str());
+    IniDoc ini;
+    SettingsIni_Save_Internal(ini, false, false, false);
+    return ini.Save(path);
+}
 
-    if (!SettingsIni_Save_Internal(tmp.c_str(), false, false, false))
+void SettingsIni_CaptureProfileValues(SettingsProfileValues* out)
+{
+    if (!out) return;
+    SettingsProfileValues v{};
+
+    v.deadzoneLow = Settings_GetInputDeadzoneLow();
+    v.deadzoneHigh = Settings_GetInputDeadzoneHigh();
+    v.antiDeadzone = Settings_GetInputAntiDeadzone();
+    v.outputCap = Settings_GetInputOutputCap();
+    v.cp1x = Settings_GetInputBezierCp1X();
+    v.cp1y = Settings_GetInputBezierCp1Y();
+    v.cp2x = Settings_GetInputBezierCp2X();
+    v.cp2y = Settings_GetInputBezierCp2Y();
+    v.cp1w = Settings_GetInputBezierCp1W();
+    v.cp2w = Settings_GetInputBezierCp2W();
+    v.curveMode = Settings_GetInputCurveMode();
+    v.invert = Settings_GetInputInvert() ? 1 : 0;
+    v.snappy = Settings_GetSnappyJoystick() ? 1 : 0;
+    v.lastKeyPriority = Settings_GetLastKeyPriority() ? 1 : 0;
+    v.lastKeyPrioritySensitivity = Settings_GetLastKeyPrioritySensitivity();
+    v.blockBoundKeys = Settings_GetBlockBoundKeys() ? 1 : 0;
+    v.blockMouseInput = Settings_GetBlockMouseInput() ? 1 : 0;
+
+    v.pollingMs = Settings_GetPollingMs();
+    v.uiRefreshMs = Settings_GetUIRefreshMs();
+    v.virtualGamepads = Settings_GetVirtualGamepadCount();
+    v.virtualGamepadsEnabled = Settings_GetVirtualGamepadsEnabled() ? 1 : 0;
+    v.digitalFallbackInput = Settings_GetDigitalFallbackInput() ? 1 : 0;
+    v.watchdogNeutralizePads = Settings_GetWatchdogNeutralizePads() ? 1 : 0;
+    v.aulaCommMode = Settings_GetAulaCommMode();
+    v.mouseToStickEnabled = Settings_GetMouseToStickEnabled() ? 1 : 0;
+    v.mouseToStickTarget = Settings_GetMouseToStickTarget();
+    v.mouseToStickSensitivity = Settings_GetMouseToStickSensitivity();
+    v.mouseToStickAggressiveness = Settings_GetMouseToStickAggressiveness();
+    v.mouseToStickMaxOffset = Settings_GetMouseToStickMaxOffset();
+    v.mouseToStickFollowSpeed = Settings_GetMouseToStickFollowSpeed();
+    v.smoothing = Settings_GetInputSmoothing() ? 1 : 0;
+    v.smoothingMinCutoffHz = Settings_GetInputSmoothingMinCutoffHz();
+    v.smoothingBeta = Settings_GetInputSmoothingBeta();
+    v.prediction = Settings_GetInputPrediction() ? 1 : 0;
+    v.predictionHorizonMs = Settings_GetInputPredictionHorizonMs();
+    static_assert(SETTINGS_MAX_GAMEPADS == 8, "SettingsProfileValues report arrays");
+    for (int pad = 0; pad < SETTINGS_MAX_GAMEPADS; ++pad)
+    {
+        v.reportPolicy[pad] = Settings_GetReportPolicy(pad);
+        v.reportStickThreshold[pad] = Settings_GetReportStickThreshold(pad);
+        v.reportTriggerThreshold[pad] = Settings_GetReportTriggerThreshold(pad);
+        v.reportFlushMs[pad] = Settings_GetReportFlushMs(pad);
+    }
+
+    *out = v;
+}
+
+// Same setter order as SettingsIni_Load_Core.
+void SettingsIni_ApplyProfileValues(const SettingsProfileValues& v)
+{
+    Settings_SetInputDeadzoneLow(v.deadzoneLow);
+    Settings_SetInputDeadzoneHigh(v.deadzoneHigh);
+
+    Settings_SetInputAntiDeadzone(v.antiDeadzone);
+    Settings_SetInputOutputCap(v.outputCap);
+
+    Settings_SetInputBezierCp1X(v.cp1x);
+    Settings_SetInputBezierCp1Y(v.cp1y);
+    Settings_SetInputBezierCp2X(v.cp2x);
+    Settings_SetInputBezierCp2Y(v.cp2y);
+
+    Settings_SetInputBezierCp1W(ClampF(v.cp1w, 0.0f, 1.0f));
+    Settings_SetInputBezierCp2W(ClampF(v.cp2w, 0.0f, 1.0f));
+
+    Settings_SetInputCurveMode(v.curveMode);
+    Settings_SetInputInvert(v.invert != 0);
+    Settings_SetSnappyJoystick(v.snappy != 0);
+    Settings_SetLastKeyPriority(v.lastKeyPriority != 0);
+    Settings_SetLastKeyPrioritySensitivity(v.lastKeyPrioritySensitivity);
+    Settings_SetBlockBoundKeys(v.blockBoundKeys != 0);
+    Settings_SetBlockMouseInput(v.blockMouseInput != 0);
+    Settings_SetInputSmoothingMinCutoffHz(v.smoothingMinCutoffHz);
+    Settings_SetInputSmoothingBeta(v.smoothingBeta);
+    Settings_SetInputSmoothing(v.smoothing != 0);
+    Settings_SetInputPredictionHorizonMs(v.predictionHorizonMs);
+    Settings_SetInputPrediction(v.prediction != 0);
+    for (int pad = 0; pad < SETTINGS_MAX_GAMEPADS; ++pad)
     {
-        DeleteFileW(tmp.c_str());
-        return false;
+        Settings_SetReportPolicy(pad, v.reportPolicy[pad]);
+        Settings_SetReportStickThreshold(pad, v.reportStickThreshold[pad]);
+        Settings_SetReportTriggerThreshold(pad, v.reportTriggerThreshold[pad]);
+        Settings_SetReportFlushMs(pad, v.reportFlushMs[pad]);
     }
 
-    return IniUtil_AtomicReplace(tmp.c_str(), path);
+    Settings_SetPollingMs(v.pollingMs);
+    Settings_SetUIRefreshMs(v.uiRefreshMs);
+    Settings_SetVirtualGamepadCount(v.virtualGamepads);
+    Settings_SetVirtualGamepadsEnabled(v.virtualGamepadsEnabled != 0);
+    Settings_SetDigitalFallbackInput(v.digitalFallbackInput != 0);
+    Settings_SetWatchdogNeutralizePads(v.watchdogNeutralizePads != 0);
+    Settings_SetAulaCommMode(v.aulaCommMode);
+    Settings_SetMouseToStickEnabled(v.mouseToStickEnabled != 0);
+    Settings_SetMouseToStickTarget(v.mouseToStickTarget);
+    Settings_SetMouseToStickSensitivity(v.mouseToStickSensitivity);
+    Settings_SetMouseToStickAggressiveness(v.mouseToStickAggressiveness);
+    Settings_SetMouseToStickMaxOffset(v.mouseToStickMaxOffset);
+    Settings_SetMouseToStickFollowSpeed(v.mouseToStickFollowSpeed);
 }
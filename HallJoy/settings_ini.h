@@ -1,7 +1,42 @@
 #pragma once
 #include <windows.h>
+#include <cstdint>
 
 bool SettingsIni_Load(const wchar_t* path);
 bool SettingsIni_Save(const wchar_t* path);
 bool SettingsIni_LoadProfile(const wchar_t* path);
 bool SettingsIni_SaveProfile(const wchar_t* path);
+
+// Build what Save / SaveProfile would write, without touching the disk
+// (snapshot for the persistence worker). UI thread: reads layout state.
+class IniDoc;
+void SettingsIni_BuildDoc(IniDoc& out);
+void SettingsIni_BuildProfileDoc(IniDoc& out);
+
+// Everything SettingsIni_LoadProfile applies except per-key curves, as flat
+// 4-byte fields (no padding) so the compiled profile cache can store it as-is.
+struct SettingsProfileValues
+{
+    float deadzoneLow, deadzoneHigh, antiDeadzone, outputCap;
+    float cp1x, cp1y, cp2x, cp2y, cp1w, cp2w;
+    uint32_t curveMode;
+    int32_t invert, snappy, lastKeyPriority;
+    float lastKeyPrioritySensitivity;
+    int32_t blockBoundKeys, blockMouseInput;
+    uint32_t pollingMs, uiRefreshMs;
+    int32_t virtualGamepads, virtualGamepadsEnabled;
+    int32_t digitalFallbackInput, watchdogNeutralizePads;
+    uint32_t aulaCommMode;
+    int32_t mouseToStickEnabled, mouseToStickTarget;
+    float mouseToStickSensitivity, mouseToStickAggressiveness;
+    float mouseToStickMaxOffset, mouseToStickFollowSpeed;
+    int32_t smoothing;
+    float smoothingMinCutoffHz, smoothingBeta;
+    int32_t prediction;
+    float predictionHorizonMs;
+    uint32_t reportPolicy[8], reportFlushMs[8];
+    int32_t reportStickThreshold[8], reportTriggerThreshold[8];
+};
+
+void SettingsIni_CaptureProfileValues(SettingsProfileValues* out);
+void SettingsIni_ApplyProfileValues(const SettingsProfileValues& v);
@@ -0,0 +1,67 @@
+// bench_rules.cpp
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench_rules.h"
+#include "auto_profile_rules.h"
+
+struct RuleCase
+{
+    const wchar_t* what;
+    const wchar_t* exePath;
+    const wchar_t* wantProfile; // nullptr = no rule (app falls back to the manual profile)
+};
+
+static int RunCases(const AutoProfileRules& rules, const RuleCase* cases, int count)
+{
+    int failed = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const RuleCase& c = cases[i];
+        const AutoProfileRule* r = rules.Match(c.exePath);
+        const wchar_t* got = r ? r->profile.c_str() : nullptr;
+        const bool ok = c.wantProfile ? (r && r->profile == c.wantProfile) : (r == nullptr);
+        if (!ok) ++failed;
+        wprintf(L"  %-4s %-34s want=%-10s got=%s\n",
+            ok ? L"ok" : L"FAIL", c.what,
+            c.wantProfile ? c.wantProfile : L"-", got ? got : L"-");
+    }
+    return failed;
+}
+
+int Rules_Check()
+{
+    AutoProfileRules rules;
+    rules.Add(L"eldenring.exe", L"Souls");
+    rules.Add(L" \"Game.exe\" ", L"First");          // quotes/spaces trimmed
+    rules.Add(L"game.exe", L"Second");                // same name: first rule wins
+    rules.Add(L"C:/Games/Special/game.exe", L"Path"); // full path beats the names
+    rules.Add(L"", L"Ignored");
+    rules.Add(L"ignored.exe", L"");
+
+    static const RuleCase kCases[] = {
+        { L"exe name, full image path", L"D:\\Steam\\ELDEN RING\\eldenring.exe", L"Souls" },
+        { L"exe name, bare", L"ELDENRING.EXE", L"Souls" },
+        { L"name collision: first rule", L"D:\\Other\\game.exe", L"First" },
+        { L"full path beats name", L"c:\\games\\special\\GAME.exe", L"Path" },
+        { L"full path, '/' separators", L"C:/Games/Special/game.exe", L"Path" },
+        { L"name is not a suffix match", L"C:\\x\\notgame.exe", nullptr },
+        { L"directory is not a name", L"C:\\eldenring.exe\\run.exe", nullptr },
+        { L"rule with empty profile", L"C:\\ignored.exe", nullptr },
+        { L"no rule: fallback", L"C:\\Windows\\explorer.exe", nullptr },
+        { L"empty path: fallback", L"", nullptr },
+    };
+
+    wprintf(L"auto-profile rules: %zu loaded (2 ignored)\n", rules.Rules().size());
+    int failed = RunCases(rules, kCases, (int)_countof(kCases));
+
+    // No rules at all: every foreground app falls back.
+    AutoProfileRules none;
+    static const RuleCase kEmpty[] = {
+        { L"no rules loaded", L"C:\\Games\\eldenring.exe", nullptr },
+    };
+    failed += RunCases(none, kEmpty, (int)_countof(kEmpty));
+
+    wprintf(L"auto-profile rules: %d failed\n", failed);
+    return failed ? 4 : 0;
+}
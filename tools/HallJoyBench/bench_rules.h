@@ -0,0 +1,9 @@
+// bench_rules.h
+#pragma once
+
+// Auto-profile rule matcher self-check: feeds fixed rule sets and image paths
+// through AutoProfileRules (the same code the app uses) and prints each case.
+// No settings, bindings or backend are involved.
+
+// Returns 0 = all cases pass, 4 = at least one case failed.
+int Rules_Check();
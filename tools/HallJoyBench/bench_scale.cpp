@@ -0,0 +1,188 @@
+// bench_scale.cpp
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench_scale.h"
+#include "backend.h"
+#include "bindings.h"
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+static bool PadHasBindings(int pad)
+{
+    for (int a = 0; a < 4; ++a)
+    {
+        AxisBinding b = Bindings_GetAxisForPad(pad, (Axis)a);
+        if (b.minusHid || b.plusHid) return true;
+    }
+    if (Bindings_GetTriggerForPad(pad, Trigger::LT) || Bindings_GetTriggerForPad(pad, Trigger::RT))
+        return true;
+    for (int b = 0; b <= (int)GameButton::DpadRight; ++b)
+        for (int c = 0; c < 4; ++c)
+            if (Bindings_GetButtonMaskChunkForPad(pad, (GameButton)b, c)) return true;
+    return false;
+}
+
+// WASD / IJKL sticks, Q/E triggers, a handful of buttons: used when no
+// bindings.ini is given so the scale run still builds real reports.
+static void BindDefaultPad0()
+{
+    Bindings_SetAxisMinusForPad(0, Axis::LX, 4);  // A
+    Bindings_SetAxisPlusForPad(0, Axis::LX, 7);   // D
+    Bindings_SetAxisMinusForPad(0, Axis::LY, 22); // S
+    Bindings_SetAxisPlusForPad(0, Axis::LY, 26);  // W
+    Bindings_SetAxisMinusForPad(0, Axis::RX, 13); // J
+    Bindings_SetAxisPlusForPad(0, Axis::RX, 15);  // L
+    Bindings_SetAxisMinusForPad(0, Axis::RY, 14); // K
+    Bindings_SetAxisPlusForPad(0, Axis::RY, 12);  // I
+    Bindings_SetTriggerForPad(0, Trigger::LT, 20); // Q
+    Bindings_SetTriggerForPad(0, Trigger::RT, 8);  // E
+    Bindings_AddButtonHidForPad(0, GameButton::A, 44); // Space
+    Bindings_AddButtonHidForPad(0, GameButton::B, 6);  // C
+    Bindings_AddButtonHidForPad(0, GameButton::X, 21); // R
+    Bindings_AddButtonHidForPad(0, GameButton::Y, 9);  // F
+}
+
+// Same keys on every pad: each extra pad adds a full report build, not just an
+// empty loop iteration.
+static void ReplicatePad0Bindings(int pads)
+{
+    for (int p = 1; p < pads; ++p)
+    {
+        if (PadHasBindings(p)) continue;
+        for (int a = 0; a < 4; ++a)
+        {
+            AxisBinding b = Bindings_GetAxisForPad(0, (Axis)a);
+            Bindings_SetAxisMinusForPad(p, (Axis)a, b.minusHid);
+            Bindings_SetAxisPlusForPad(p, (Axis)a, b.plusHid);
+        }
+        Bindings_SetTriggerForPad(p, Trigger::LT, Bindings_GetTriggerForPad(0, Trigger::LT));
+        Bindings_SetTriggerForPad(p, Trigger::RT, Bindings_GetTriggerForPad(0, Trigger::RT));
+        for (int b = 0; b <= (int)GameButton::DpadRight; ++b)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                uint64_t m = Bindings_GetButtonMaskChunkForPad(0, (GameButton)b, c);
+                for (int bit = 0; bit < 64; ++bit)
+                    if (m & (1ULL << bit))
+                        Bindings_AddButtonHidForPad(p, (GameButton)b, (uint16_t)(c * 64 + bit));
+            }
+        }
+    }
+}
+
+struct ScaleStep
+{
+    int pads = 0;
+    double meanUs = 0.0;
+    double p99Us = 0.0;
+    double reportsUs = 0.0; // reports + submit stages
+};
+
+static ScaleStep RunStep(int pads, const std::vector<uint16_t>& hids, double seconds)
+{
+    Backend_InitHeadless(pads);
+    Backend_ResetTickProfile();
+
+    LARGE_INTEGER freq{};
+    QueryPerformanceFrequency(&freq);
+    const double usPerQpc = 1000000.0 / (double)freq.QuadPart;
+
+    std::vector<double> tickUs;
+    tickUs.reserve(1u << 20);
+    const int64_t end = QpcNow() + (int64_t)(seconds * (double)freq.QuadPart);
+    uint64_t i = 0;
+    while (QpcNow() < end)
+    {
+        // 1 kHz simulated time so the input pattern is identical for every step.
+        double tMs = (double)i++;
+        for (size_t k = 0; k < hids.size(); ++k)
+        {
+            double periodMs = 300.0 + 70.0 * (double)(k % 12);
+            double phase = std::fmod(tMs + 37.0 * (double)k, periodMs) / periodMs;
+            double tri = (phase < 0.5) ? (phase * 2.0) : (2.0 - phase * 2.0);
+            BackendSim_SetRawMilli(hids[k], (uint16_t)std::lround(std::clamp((tri - 0.2) / 0.8, 0.0, 1.0) * 1000.0));
+        }
+
+        int64_t t0 = QpcNow();
+        Backend_Tick();
+        tickUs.push_back((double)(QpcNow() - t0) * usPerQpc);
+    }
+
+    BackendTickProfile prof{};
+    Backend_GetTickProfile(&prof);
+    Backend_Shutdown();
+
+    ScaleStep st{};
+    st.pads = pads;
+    if (tickUs.empty()) return st;
+
+    double sum = 0.0;
+    for (double v : tickUs) sum += v;
+    st.meanUs = sum / (double)tickUs.size();
+    std::sort(tickUs.begin(), tickUs.end());
+    st.p99Us = tickUs[std::min(tickUs.size() - 1, (size_t)std::ceil(0.99 * (double)tickUs.size()))];
+    st.reportsUs = (prof.totalStageUs[BackendTickStage_Reports] + prof.totalStageUs[BackendTickStage_Submit]) /
+        (double)std::max<uint64_t>(1, prof.ticks);
+    return st;
+}
+
+int Scale_Run(const ScaleOptions& opt)
+{
+    const int maxPads = std::clamp(opt.maxPads, 1, BINDINGS_MAX_GAMEPADS);
+    if (!PadHasBindings(0))
+        BindDefaultPad0();
+    if (opt.replicateBindings)
+        ReplicatePad0Bindings(maxPads);
+
+    std::vector<uint16_t> hids;
+    for (uint16_t hid = 1; hid < 256; ++hid)
+        if (Bindings_IsHidBound(hid)) hids.push_back(hid);
+
+    wprintf(L"halljoy-bench scale: pads=1..%d bound_hids=%zu %.1f s per step\n\n",
+        maxPads, hids.size(), opt.secondsPerStep);
+
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+    std::vector<ScaleStep> steps;
+    for (int n = 1; n <= maxPads; ++n)
+        steps.push_back(RunStep(n, hids, opt.secondsPerStep));
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL);
+
+    // Least-squares fit of per-pad stages: reportsUs = a + b * pads.
+    double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+    for (const ScaleStep& s : steps)
+    {
+        sx += s.pads; sy += s.reportsUs;
+        sxx += (double)s.pads * s.pads; sxy += s.pads * s.reportsUs;
+    }
+    const double n = (double)steps.size();
+    const double den = n * sxx - sx * sx;
+    const double slope = (den != 0.0) ? (n * sxy - sx * sy) / den : 0.0;
+    const double icept = (sy - slope * sx) / n;
+
+    wprintf(L"%5s %10s %10s %12s %10s %8s\n", L"pads", L"mean_us", L"p99_us", L"pads_us", L"fit_us", L"dev");
+    double worstDev = 0.0;
+    for (const ScaleStep& s : steps)
+    {
+        double fit = icept + slope * s.pads;
+        double dev = (fit > 0.0) ? 100.0 * (s.reportsUs - fit) / fit : 0.0;
+        worstDev = std::max(worstDev, std::fabs(dev));
+        wprintf(L"%5d %10.2f %10.2f %12.2f %10.2f %7.1f%%\n", s.pads, s.meanUs, s.p99Us, s.reportsUs, fit, dev);
+    }
+    wprintf(L"\nper active pad: %.2f us (fixed %.2f us), worst deviation from linear %.1f%%\n",
+        slope, icept, worstDev);
+
+    return (worstDev > opt.maxDevPct) ? 2 : 0;
+}
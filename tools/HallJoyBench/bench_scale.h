@@ -0,0 +1,17 @@
+// bench_scale.h
+#pragma once
+
+// Pad-count scaling: runs the same synthetic input back-to-back with 1..maxPads
+// active pads and prints per-tick cost per pad count plus a linear fit, so a
+// regression that makes inactive pads cost something (or active ones cost more
+// than linear) shows up in one table.
+struct ScaleOptions
+{
+    int maxPads = 8;
+    double secondsPerStep = 2.0;
+    bool replicateBindings = true; // copy pad 1 bindings to every empty pad
+    double maxDevPct = 25.0;       // fail if a step deviates more from the linear fit
+};
+
+// Returns 0 = ok, 2 = per-pad cost deviates from linear by more than maxDevPct.
+int Scale_Run(const ScaleOptions& opt);
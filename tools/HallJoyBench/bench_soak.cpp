@@ -0,0 +1,376 @@
+// bench_soak.cpp
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "bench_soak.h"
+#include "backend.h"
+#include "bindings.h"
+#include "key_settings.h"
+#include "settings.h"
+
+#pragma comment(lib, "psapi.lib")
+
+static std::atomic<bool> g_soakStop{ false };
+
+static BOOL WINAPI SoakCtrlHandler(DWORD type)
+{
+    if (type == CTRL_C_EVENT || type == CTRL_BREAK_EVENT)
+    {
+        g_soakStop.store(true, std::memory_order_release);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+// Fixed-size tick histogram (0.25 us buckets up to 1 ms) so a multi-hour run
+// does not grow its own memory while it is measuring growth.
+static constexpr int kHistBuckets = 4096;
+static constexpr double kHistBucketUs = 0.25;
+
+struct SoakWindow
+{
+    uint64_t ticks = 0;
+    double sumUs = 0.0;
+    double maxUs = 0.0;
+    std::array<uint32_t, kHistBuckets + 1> hist{};
+
+    void Add(double us)
+    {
+        ++ticks;
+        sumUs += us;
+        if (us > maxUs) maxUs = us;
+        int b = (int)(us / kHistBucketUs);
+        hist[(size_t)std::clamp(b, 0, kHistBuckets)]++;
+    }
+
+    double Mean() const { return ticks ? (sumUs / (double)ticks) : 0.0; }
+
+    double Percentile(double p) const
+    {
+        if (!ticks) return 0.0;
+        uint64_t want = (uint64_t)std::ceil(p * (double)ticks);
+        uint64_t acc = 0;
+        for (int i = 0; i <= kHistBuckets; ++i)
+        {
+            acc += hist[(size_t)i];
+            if (acc >= want)
+                return (i == kHistBuckets) ? maxUs : (double)(i + 1) * kHistBucketUs;
+        }
+        return maxUs;
+    }
+};
+
+struct SoakMemory
+{
+    uint64_t privateKb = 0;
+    uint64_t workingSetKb = 0;
+    DWORD handles = 0;
+};
+
+static SoakMemory SampleMemory()
+{
+    SoakMemory m;
+    PROCESS_MEMORY_COUNTERS_EX pmc{};
+    pmc.cb = sizeof(pmc);
+    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc)))
+    {
+        m.privateKb = (uint64_t)pmc.PrivateUsage / 1024u;
+        m.workingSetKb = (uint64_t)pmc.WorkingSetSize / 1024u;
+    }
+    GetProcessHandleCount(GetCurrentProcess(), &m.handles);
+    return m;
+}
+
+static uint16_t RandomHid(std::mt19937& rng)
+{
+    return (uint16_t)std::uniform_int_distribution<int>(1, 255)(rng);
+}
+
+static KeyDeadzone RandomCurve(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    KeyDeadzone k;
+    k.useUnique = (rng() & 3u) != 0;
+    k.invert = (rng() & 15u) == 0;
+    k.curveMode = (uint8_t)(rng() & 1u);
+    k.low = 0.3f * u(rng);
+    k.high = 0.6f + 0.4f * u(rng);
+    k.antiDeadzone = 0.2f * u(rng);
+    k.outputCap = 0.8f + 0.2f * u(rng);
+    k.cp1_x = k.low + (k.high - k.low) * 0.33f;
+    k.cp2_x = k.low + (k.high - k.low) * 0.66f;
+    k.cp1_y = u(rng);
+    k.cp2_y = u(rng);
+    k.cp1_w = u(rng);
+    k.cp2_w = u(rng);
+    return k;
+}
+
+static void RandomizePadBindings(std::mt19937& rng, int pad)
+{
+    for (int a = 0; a < 4; ++a)
+    {
+        Bindings_SetAxisMinusForPad(pad, (Axis)a, RandomHid(rng));
+        Bindings_SetAxisPlusForPad(pad, (Axis)a, RandomHid(rng));
+    }
+    Bindings_SetTriggerForPad(pad, Trigger::LT, RandomHid(rng));
+    Bindings_SetTriggerForPad(pad, Trigger::RT, RandomHid(rng));
+    for (int b = 0; b <= (int)GameButton::DpadRight; ++b)
+        Bindings_AddButtonHidForPad(pad, (GameButton)b, RandomHid(rng));
+}
+
+// One UI-like mutation or read. Mirrors what the settings pages, layout editor
+// and Main page do from the UI thread while the realtime thread ticks.
+static void UiMutateOnce(std::mt19937& rng, int pads, std::vector<uint16_t>& tracked)
+{
+    int pad = (int)(rng() % (uint32_t)pads);
+    switch (rng() % 8u)
+    {
+    case 0:
+    case 1:
+        KeySettings_Set(RandomHid(rng), RandomCurve(rng));
+        break;
+    case 2:
+    {
+        GameButton b = (GameButton)(rng() % ((uint32_t)GameButton::DpadRight + 1u));
+        uint16_t hid = RandomHid(rng);
+        if (Bindings_ButtonHasHidForPad(pad, b, hid)) Bindings_RemoveButtonHidForPad(pad, b, hid);
+        else Bindings_AddButtonHidForPad(pad, b, hid);
+        break;
+    }
+    case 3:
+    {
+        Axis a = (Axis)(rng() % 4u);
+        if (rng() & 1u) Bindings_SetAxisMinusForPad(pad, a, RandomHid(rng));
+        else Bindings_SetAxisPlusForPad(pad, a, RandomHid(rng));
+        break;
+    }
+    case 4:
+        Bindings_SetTriggerForPad(pad, (rng() & 1u) ? Trigger::LT : Trigger::RT, RandomHid(rng));
+        break;
+    case 5:
+    {
+        tracked.clear();
+        int n = (int)(rng() % 257u);
+        for (int i = 0; i < n; ++i) tracked.push_back(RandomHid(rng));
+        BackendUI_SetTrackedHids(tracked.data(), (int)tracked.size());
+        break;
+    }
+    case 6:
+        if ((rng() & 63u) == 0)
+        {
+            Bindings_ClearHidForPad(pad, RandomHid(rng));
+        }
+        else
+        {
+            std::uniform_real_distribution<float> u(0.0f, 1.0f);
+            Settings_SetMouseToStickSensitivity(0.5f + 3.0f * u(rng));
+            Settings_SetMouseToStickFollowSpeed(0.5f + 2.0f * u(rng));
+        }
+        break;
+    default:
+        // Main page repaint: consume dirty bits and read tracked values.
+        for (int c = 0; c < 4; ++c) (void)BackendUI_ConsumeDirtyChunk(c);
+        for (uint16_t hid : tracked)
+        {
+            (void)BackendUI_GetAnalogMilli(hid);
+            (void)BackendUI_GetRawMilli(hid);
+        }
+        break;
+    }
+}
+
+int Soak_Run(const SoakOptions& opt)
+{
+    const int pads = std::clamp(opt.pads, 1, BINDINGS_MAX_GAMEPADS);
+    const double reportSec = std::max(1.0, opt.reportSec);
+
+    SetConsoleCtrlHandler(SoakCtrlHandler, TRUE);
+
+    Settings_SetMouseToStickEnabled(true);
+    Backend_InitHeadless(pads);
+
+    std::mt19937 tickRng(0x5eed1u);
+    if (opt.randomBindings)
+    {
+        for (int p = 0; p < pads; ++p)
+            RandomizePadBindings(tickRng, p);
+    }
+
+    std::atomic<uint64_t> uiOps{ 0 };
+    std::atomic<uint64_t> reads{ 0 };
+
+    std::thread uiThread([&]() {
+        std::mt19937 rng(0x5eed2u);
+        std::vector<uint16_t> tracked;
+        tracked.reserve(256);
+        const double perMs = std::max(0.001, opt.uiOpsPerSec / 1000.0);
+        double budget = 0.0;
+        while (!g_soakStop.load(std::memory_order_acquire))
+        {
+            budget += perMs;
+            while (budget >= 1.0)
+            {
+                UiMutateOnce(rng, pads, tracked);
+                uiOps.fetch_add(1, std::memory_order_relaxed);
+                budget -= 1.0;
+            }
+            Sleep(1);
+        }
+    });
+
+    std::thread readerThread([&]() {
+        uint64_t n = 0;
+        while (!g_soakStop.load(std::memory_order_acquire))
+        {
+            for (int p = 0; p < pads; ++p)
+            {
+                XUSB_REPORT r{};
+                (void)Backend_ReadLastReportChecked(p, &r);
+            }
+            if ((++n & 63u) == 0)
+            {
+                reads.fetch_add(64u * (uint64_t)pads, std::memory_order_relaxed);
+                SwitchToThread();
+            }
+        }
+    });
+
+    LARGE_INTEGER freq{};
+    QueryPerformanceFrequency(&freq);
+    const double usPerQpc = 1000000.0 / (double)freq.QuadPart;
+    const int64_t windowQpc = (int64_t)(reportSec * (double)freq.QuadPart);
+    const int64_t runQpc = (int64_t)(std::max(1.0, opt.seconds) * (double)freq.QuadPart);
+
+    wprintf(L"halljoy-bench soak: pads=%d seconds=%.0f window=%.0fs ui_ops/s=%.0f (Ctrl+C stops early)\n",
+        pads, opt.seconds, reportSec, opt.uiOpsPerSec);
+    wprintf(L"%9s %12s %9s %9s %9s %10s %10s %7s %12s %12s %6s\n",
+        L"elapsed", L"ticks", L"mean_us", L"p99_us", L"max_us",
+        L"priv_kb", L"ws_kb", L"handles", L"ks_retry", L"rpt_retry", L"torn");
+
+    std::array<uint16_t, 256> raw{};
+    std::uniform_int_distribution<int> step(-150, 150);
+    std::uniform_int_distribution<int> mouse(-12, 12);
+
+    SoakWindow win;
+    SoakWindow firstWin;
+    SoakWindow baseWin;
+    SoakWindow lastWin;
+    SoakMemory baseMem{};
+    SoakMemory lastMem{};
+    int windows = 0;
+    uint64_t totalTicks = 0;
+    uint64_t lastKsRetry = KeySettings_GetSnapshotRetryCount();
+    uint64_t lastRptRetry = Backend_GetLastReportRetryCount();
+
+    const int64_t runStart = QpcNow();
+    int64_t windowStart = runStart;
+
+    while (!g_soakStop.load(std::memory_order_acquire))
+    {
+        // Random walk on a handful of HIDs per tick, with occasional hard
+        // edges so buttons and snap-stick paths flip too.
+        for (int k = 0; k < 16; ++k)
+        {
+            uint16_t hid = RandomHid(tickRng);
+            int v = (int)raw[hid];
+            uint32_t r = tickRng() & 31u;
+            if (r == 0) v = 0;
+            else if (r == 1) v = 1000;
+            else v = std::clamp(v + step(tickRng), 0, 1000);
+            raw[hid] = (uint16_t)v;
+            BackendSim_SetRawMilli(hid, (uint16_t)v);
+        }
+        Backend_AddMouseDelta(mouse(tickRng), mouse(tickRng));
+
+        int64_t t0 = QpcNow();
+        Backend_Tick();
+        int64_t t1 = QpcNow();
+        win.Add((double)(t1 - t0) * usPerQpc);
+        ++totalTicks;
+
+        bool done = (t1 - runStart) >= runQpc;
+        if (t1 - windowStart < windowQpc && !done)
+            continue;
+
+        SoakMemory mem = SampleMemory();
+        uint64_t ksRetry = KeySettings_GetSnapshotRetryCount();
+        uint64_t rptRetry = Backend_GetLastReportRetryCount();
+        double elapsedSec = (double)(t1 - runStart) * usPerQpc / 1000000.0;
+        int h = (int)(elapsedSec / 3600.0);
+        int m = (int)std::fmod(elapsedSec / 60.0, 60.0);
+        int s = (int)std::fmod(elapsedSec, 60.0);
+
+        wprintf(L"%3d:%02d:%02d %12llu %9.2f %9.2f %9.2f %10llu %10llu %7lu %12llu %12llu %6llu\n",
+            h, m, s, (unsigned long long)win.ticks, win.Mean(), win.Percentile(0.99), win.maxUs,
+            (unsigned long long)mem.privateKb, (unsigned long long)mem.workingSetKb, (unsigned long)mem.handles,
+            (unsigned long long)(ksRetry - lastKsRetry), (unsigned long long)(rptRetry - lastRptRetry),
+            (unsigned long long)Backend_GetLastReportTornCount());
+        fflush(stdout);
+
+        // Window 0 is warm-up (caches, first allocations); window 1 is the baseline.
+        if (windows == 0) { firstWin = win; baseWin = win; baseMem = mem; }
+        else if (windows == 1) { baseWin = win; baseMem = mem; }
+        lastWin = win;
+        lastMem = mem;
+        ++windows;
+
+        lastKsRetry = ksRetry;
+        lastRptRetry = rptRetry;
+        win = SoakWindow{};
+        windowStart = t1;
+        if (done) break;
+    }
+
+    g_soakStop.store(true, std::memory_order_release);
+    uiThread.join();
+    readerThread.join();
+    Backend_Shutdown();
+    SetConsoleCtrlHandler(SoakCtrlHandler, FALSE);
+
+    const double elapsedHours = (double)(QpcNow() - runStart) * usPerQpc / 3600000000.0;
+    const uint64_t torn = Backend_GetLastReportTornCount();
+    const double driftPct = (baseWin.Mean() > 0.0)
+        ? (100.0 * (lastWin.Mean() - baseWin.Mean()) / baseWin.Mean()) : 0.0;
+    const double p99DriftPct = (baseWin.Percentile(0.99) > 0.0)
+        ? (100.0 * (lastWin.Percentile(0.99) - baseWin.Percentile(0.99)) / baseWin.Percentile(0.99)) : 0.0;
+    const double growthKb = (double)lastMem.privateKb - (double)baseMem.privateKb;
+    const long handleGrowth = (long)lastMem.handles - (long)baseMem.handles;
+
+    wprintf(L"\nsoak summary: %.2f h, %llu ticks, %d windows, ui_ops=%llu, checked_reads=%llu\n",
+        elapsedHours, (unsigned long long)totalTicks, windows,
+        (unsigned long long)uiOps.load(), (unsigned long long)reads.load());
+    wprintf(L"  warm-up mean=%.2f us, baseline mean=%.2f us p99=%.2f us, last mean=%.2f us p99=%.2f us\n",
+        firstWin.Mean(), baseWin.Mean(), baseWin.Percentile(0.99), lastWin.Mean(), lastWin.Percentile(0.99));
+    wprintf(L"  drift: mean %+.1f%%, p99 %+.1f%% (limit %.1f%%)\n", driftPct, p99DriftPct, opt.maxDriftPct);
+    wprintf(L"  memory: private %+.0f KB since baseline (limit %.0f KB), handles %+ld\n",
+        growthKb, opt.maxGrowthKb, handleGrowth);
+    wprintf(L"  seqlock retries: key settings=%llu, last report=%llu; torn reads=%llu\n",
+        (unsigned long long)KeySettings_GetSnapshotRetryCount(),
+        (unsigned long long)Backend_GetLastReportRetryCount(),
+        (unsigned long long)torn);
+
+    if (torn > 0) return 3;
+    if (windows >= 3 && (driftPct > opt.maxDriftPct || growthKb > opt.maxGrowthKb || handleGrowth > 16))
+        return 2;
+    return 0;
+}
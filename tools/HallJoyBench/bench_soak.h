@@ -0,0 +1,19 @@
+// bench_soak.h
+#pragma once
+
+// Long-running stress mode: back-to-back ticks with simulated input on every
+// HID, a thread that mutates settings/bindings/tracked HIDs the way the UI does,
+// and a reader hammering the last-report seqlock. Reports per-window stats.
+struct SoakOptions
+{
+    int pads = 4;
+    double seconds = 4.0 * 3600.0;
+    double reportSec = 60.0;     // stats window length
+    double uiOpsPerSec = 2000.0; // UI mutator rate
+    double maxDriftPct = 25.0;   // fail if mean tick time grows more than this
+    double maxGrowthKb = 4096.0; // fail if private bytes grow more than this
+    bool randomBindings = true;  // false = keep the loaded bindings.ini
+};
+
+// Returns 0 = ok, 2 = drift/memory limit exceeded, 3 = torn reads detected.
+int Soak_Run(const SoakOptions& opt);
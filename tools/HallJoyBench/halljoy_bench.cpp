@@ -0,0 +1,562 @@
+// halljoy_bench.cpp
+// Headless backend bench: loads a real settings.ini + bindings.ini through the
+// app loaders, replays an input trace (or a synthetic sweep) through Backend_Tick
+// at a fixed tick rate and prints tick/stage timings and report counts.
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <mmsystem.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_rules.h"
+#include "bench_scale.h"
+#include "bench_soak.h"
+#include "backend.h"
+#include "backend_predict.h"
+#include "bindings.h"
+#include "key_settings.h"
+#include "keyboard_layout.h"
+#include "profile_ini.h"
+#include "settings.h"
+#include "settings_ini.h"
+
+#pragma comment(lib, "winmm.lib")
+
+struct BenchOptions
+{
+    std::wstring settingsPath;
+    std::wstring bindingsPath;
+    std::wstring tracePath;
+    double rateHz = 1000.0;
+    double seconds = 10.0;
+    bool secondsSet = false;
+    int pads = 0;             // 0 = from settings
+    double budgetUs = 0.0;    // 0 = tick period
+    bool fast = false;        // no real-time pacing
+    bool trackLayout = false; // feed layout HIDs to the tracked (UI) snapshot
+
+    bool soak = false;
+    SoakOptions soakOpt;
+
+    bool scale = false;
+    ScaleOptions scaleOpt;
+
+    bool checkRules = false;
+};
+
+// One trace event. hid != 0: raw key value; hid == 0: mouse delta.
+struct TraceEvent
+{
+    double tMs = 0.0;
+    uint16_t hid = 0;
+    uint16_t rawMilli = 0;
+    int dx = 0;
+    int dy = 0;
+};
+
+static void PrintUsage()
+{
+    wprintf(
+        L"usage: halljoy-bench --settings <settings.ini> --bindings <bindings.ini> [options]\n"
+        L"  --trace <file>      replay trace; without it all bound HIDs get a synthetic sweep\n"
+        L"  --rate <hz>         tick rate (default 1000)\n"
+        L"  --seconds <s>       run length (default: trace length, or 10 s)\n"
+        L"  --pads <n>          override virtual gamepad count (1..%d)\n"
+        L"  --budget-us <us>    tick budget (default: tick period)\n"
+        L"  --fast              run ticks back-to-back instead of in real time\n"
+        L"  --track-layout      also run the UI snapshot for every layout key\n"
+        L"\n"
+        L"soak mode (settings/bindings optional; random bindings when none given):\n"
+        L"  --soak              max-rate ticks + UI mutator + report reader for hours\n"
+        L"  --seconds <s>       run length (default 14400)\n"
+        L"  --report-sec <s>    stats window (default 60)\n"
+        L"  --ui-rate <ops/s>   UI mutations per second (default 2000)\n"
+        L"  --max-drift-pct <p> fail if mean tick time drifts more (default 25)\n"
+        L"  --max-growth-kb <k> fail if private bytes grow more (default 4096)\n"
+        L"\n"
+        L"scale mode (settings/bindings optional; WASD defaults when none given):\n"
+        L"  --scale             back-to-back ticks with 1..n active pads, linear fit\n"
+        L"  --pads <n>          largest pad count (default %d)\n"
+        L"  --seconds <s>       run length per pad count (default 2)\n"
+        L"  --max-dev-pct <p>   fail if a step deviates more from linear (default 25)\n"
+        L"\n"
+        L"  --check-rules       self-check of the auto-profile rule matcher, then exit\n"
+        L"\n"
+        L"trace format (text, one event per line, '#' comments):\n"
+        L"  <time_ms> <hid> <raw_milli>       analog value 0..1000 for HID 1..255\n"
+        L"  <time_ms> mouse <dx> <dy>         raw mouse delta (mouse-to-stick)\n",
+        BINDINGS_MAX_GAMEPADS, BINDINGS_MAX_GAMEPADS);
+}
+
+static bool ParseArgs(int argc, wchar_t** argv, BenchOptions& o)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::wstring a = argv[i];
+        auto next = [&](const wchar_t** out) -> bool {
+            if (i + 1 >= argc) return false;
+            *out = argv[++i];
+            return true;
+        };
+        const wchar_t* v = nullptr;
+
+        if (a == L"--settings" && next(&v)) o.settingsPath = v;
+        else if (a == L"--bindings" && next(&v)) o.bindingsPath = v;
+        else if (a == L"--trace" && next(&v)) o.tracePath = v;
+        else if (a == L"--rate" && next(&v)) o.rateHz = _wtof(v);
+        else if (a == L"--seconds" && next(&v)) { o.seconds = _wtof(v); o.secondsSet = true; }
+        else if (a == L"--pads" && next(&v)) o.pads = _wtoi(v);
+        else if (a == L"--budget-us" && next(&v)) o.budgetUs = _wtof(v);
+        else if (a == L"--fast") o.fast = true;
+        else if (a == L"--track-layout") o.trackLayout = true;
+        else if (a == L"--soak") o.soak = true;
+        else if (a == L"--report-sec" && next(&v)) o.soakOpt.reportSec = _wtof(v);
+        else if (a == L"--ui-rate" && next(&v)) o.soakOpt.uiOpsPerSec = _wtof(v);
+        else if (a == L"--max-drift-pct" && next(&v)) o.soakOpt.maxDriftPct = _wtof(v);
+        else if (a == L"--max-growth-kb" && next(&v)) o.soakOpt.maxGrowthKb = _wtof(v);
+        else if (a == L"--scale") o.scale = true;
+        else if (a == L"--max-dev-pct" && next(&v)) o.scaleOpt.maxDevPct = _wtof(v);
+        else if (a == L"--check-rules") o.checkRules = true;
+        else
+        {
+            fwprintf(stderr, L"unknown or incomplete argument: %s\n", a.c_str());
+            return false;
+        }
+    }
+
+    if (!o.soak && !o.scale && !o.checkRules && (o.settingsPath.empty() || o.bindingsPath.empty()))
+        return false;
+    o.rateHz = std::clamp(o.rateHz, 1.0, 20000.0);
+    return true;
+}
+
+static bool LoadTrace(const std::wstring& path, std::vector<TraceEvent>& out)
+{
+    std::ifstream f(path);
+    if (!f) return false;
+
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(f, line))
+    {
+        ++lineNo;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream ss(line);
+        std::string tStr, what;
+        if (!(ss >> tStr)) continue;
+        if (!(ss >> what))
+        {
+            fwprintf(stderr, L"trace:%d: missing fields\n", lineNo);
+            return false;
+        }
+
+        TraceEvent e;
+        e.tMs = std::atof(tStr.c_str());
+        if (what == "mouse")
+        {
+            if (!(ss >> e.dx >> e.dy))
+            {
+                fwprintf(stderr, L"trace:%d: bad mouse event\n", lineNo);
+                return false;
+            }
+        }
+        else
+        {
+            int hid = std::atoi(what.c_str());
+            int milli = 0;
+            if (!(ss >> milli) || hid <= 0 || hid >= 256)
+            {
+                fwprintf(stderr, L"trace:%d: bad key event\n", lineNo);
+                return false;
+            }
+            e.hid = (uint16_t)hid;
+            e.rawMilli = (uint16_t)std::clamp(milli, 0, 1000);
+        }
+        out.push_back(e);
+    }
+
+    std::stable_sort(out.begin(), out.end(),
+        [](const TraceEvent& a, const TraceEvent& b) { return a.tMs < b.tMs; });
+    return true;
+}
+
+// Triangle wave per bound HID with co-prime-ish periods, so pads see a mix of
+// analog movement, button edges and idle stretches.
+static uint16_t SyntheticRawMilli(size_t i, double tMs)
+{
+    double periodMs = 300.0 + 70.0 * (double)(i % 12);
+    double phase = std::fmod(tMs + 37.0 * (double)i, periodMs) / periodMs;
+    double tri = (phase < 0.5) ? (phase * 2.0) : (2.0 - phase * 2.0);
+    // Hold at rest for part of each period.
+    double v = std::clamp((tri - 0.2) / 0.8, 0.0, 1.0);
+    return (uint16_t)std::lround(v * 1000.0);
+}
+
+static void ApplySyntheticInputs(const std::vector<uint16_t>& hids, double tMs)
+{
+    for (size_t i = 0; i < hids.size(); ++i)
+        BackendSim_SetRawMilli(hids[i], SyntheticRawMilli(i, tMs));
+}
+
+// Ground truth for the prediction metrics: the raw value a key will have at any
+// sim time, from the synthetic formula or the trace's per-HID step function.
+struct InputTimeline
+{
+    bool synthetic = true;
+    std::vector<int> syntheticIndex = std::vector<int>(256, -1);
+    std::vector<std::vector<std::pair<double, float>>> steps = std::vector<std::vector<std::pair<double, float>>>(256);
+
+    float ValueAt(uint16_t hid, double tMs) const
+    {
+        if (synthetic)
+        {
+            int i = syntheticIndex[hid];
+            return (i < 0) ? 0.0f : (float)SyntheticRawMilli((size_t)i, tMs) / 1000.0f;
+        }
+        const auto& s = steps[hid];
+        auto it = std::upper_bound(s.begin(), s.end(), tMs,
+            [](double t, const std::pair<double, float>& e) { return t < e.first; });
+        return (it == s.begin()) ? 0.0f : std::prev(it)->second;
+    }
+};
+
+// How the predicted travel compares with where each key actually went.
+// Overshoot = how far the prediction lands outside the range the key covers
+// over the next horizon (e.g. beyond a turning point).
+struct PredictionStats
+{
+    uint64_t samples = 0;
+    uint64_t extrapolated = 0;
+    double errRawSum = 0.0;  // |input - truth(t + h)|: lag without prediction
+    double errPredSum = 0.0; // |output - truth(t + h)|
+    uint64_t overshoots = 0; // overshoot > 0.01 travel
+    double overshootSum = 0.0;
+    double overshootMax = 0.0;
+};
+
+static void AccumulatePrediction(PredictionStats& st, const InputTimeline& tl,
+    const std::vector<uint16_t>& hids, double simMs, double horizonMs)
+{
+    for (uint16_t hid : hids)
+    {
+        float in = 0.0f, out = 0.0f;
+        if (!BackendPredict_GetLast(hid, &in, &out)) continue;
+
+        const float future = tl.ValueAt(hid, simMs + horizonMs);
+        float lo = future, hi = future;
+        for (double dt = 0.0; dt < horizonMs; dt += 0.25)
+        {
+            float v = tl.ValueAt(hid, simMs + dt);
+            lo = std::min(lo, v);
+            hi = std::max(hi, v);
+        }
+        const double over = std::max({ 0.0, (double)(out - hi), (double)(lo - out) });
+
+        ++st.samples;
+        if (out != in) ++st.extrapolated;
+        st.errRawSum += std::fabs((double)(in - future));
+        st.errPredSum += std::fabs((double)(out - future));
+        st.overshootSum += over;
+        st.overshootMax = std::max(st.overshootMax, over);
+        if (over > 0.01) ++st.overshoots;
+    }
+}
+
+static double Percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t idx = (size_t)std::ceil(p * (double)sorted.size());
+    idx = std::clamp<size_t>(idx, 1, sorted.size()) - 1;
+    return sorted[idx];
+}
+
+static int64_t QpcNow()
+{
+    LARGE_INTEGER li{};
+    QueryPerformanceCounter(&li);
+    return (int64_t)li.QuadPart;
+}
+
+int wmain(int argc, wchar_t** argv)
+{
+    BenchOptions opt;
+    if (!ParseArgs(argc, argv, opt))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (opt.checkRules)
+        return Rules_Check();
+
+    if (!opt.settingsPath.empty() && !SettingsIni_Load(opt.settingsPath.c_str()))
+    {
+        fwprintf(stderr, L"failed to load settings: %s\n", opt.settingsPath.c_str());
+        return 1;
+    }
+    if (!opt.bindingsPath.empty() && !Profile_LoadIni(opt.bindingsPath.c_str()))
+    {
+        fwprintf(stderr, L"failed to load bindings: %s\n", opt.bindingsPath.c_str());
+        return 1;
+    }
+
+    if (opt.soak)
+    {
+        opt.soakOpt.pads = (opt.pads > 0) ? opt.pads : BINDINGS_MAX_GAMEPADS;
+        if (opt.secondsSet) opt.soakOpt.seconds = opt.seconds;
+        opt.soakOpt.randomBindings = opt.bindingsPath.empty();
+        return Soak_Run(opt.soakOpt);
+    }
+
+    if (opt.scale)
+    {
+        if (opt.pads > 0) opt.scaleOpt.maxPads = opt.pads;
+        if (opt.secondsSet) opt.scaleOpt.secondsPerStep = opt.seconds;
+        return Scale_Run(opt.scaleOpt);
+    }
+
+    std::vector<TraceEvent> trace;
+    if (!opt.tracePath.empty() && !LoadTrace(opt.tracePath, trace))
+    {
+        fwprintf(stderr, L"failed to load trace: %s\n", opt.tracePath.c_str());
+        return 1;
+    }
+    if (!trace.empty() && !opt.secondsSet)
+        opt.seconds = trace.back().tMs / 1000.0 + 0.25; // let the last edge settle
+
+    int pads = (opt.pads > 0) ? opt.pads : Settings_GetVirtualGamepadCount();
+    pads = std::clamp(pads, 1, BINDINGS_MAX_GAMEPADS);
+
+    std::vector<uint16_t> boundHids;
+    for (uint16_t hid = 1; hid < 256; ++hid)
+    {
+        for (int p = 0; p < pads; ++p)
+        {
+            if (Bindings_IsHidBoundForPad(p, hid)) { boundHids.push_back(hid); break; }
+        }
+    }
+
+    std::vector<std::pair<uint16_t, KeyDeadzone>> overrides;
+    KeySettings_Enumerate(overrides);
+    size_t uniqueCurves = 0;
+    for (const auto& kv : overrides)
+        if (kv.second.useUnique) ++uniqueCurves;
+
+    InputTimeline timeline;
+    timeline.synthetic = trace.empty();
+    for (size_t i = 0; i < boundHids.size(); ++i)
+        timeline.syntheticIndex[boundHids[i]] = (int)i;
+    for (const TraceEvent& e : trace)
+        if (e.hid != 0) timeline.steps[e.hid].push_back({ e.tMs, (float)e.rawMilli / 1000.0f });
+
+    // Prediction works on wall-clock dt, so back-to-back ticks would make it meaningless.
+    const bool measurePrediction = Settings_GetInputPrediction() && !opt.fast;
+    const double horizonMs = Settings_GetInputPredictionHorizonMs();
+    PredictionStats predStats;
+
+    Backend_InitHeadless(pads);
+
+    if (opt.trackLayout)
+    {
+        std::vector<uint16_t> tracked;
+        const KeyDef* keys = KeyboardLayout_Data();
+        for (int i = 0; i < KeyboardLayout_Count(); ++i)
+            tracked.push_back(keys[i].hid);
+        BackendUI_SetTrackedHids(tracked.data(), (int)tracked.size());
+    }
+
+    const double periodMs = 1000.0 / opt.rateHz;
+    const double budgetUs = (opt.budgetUs > 0.0) ? opt.budgetUs : periodMs * 1000.0;
+    const uint64_t tickCount = (uint64_t)std::max(1.0, std::floor(opt.seconds * opt.rateHz));
+
+    LARGE_INTEGER freq{};
+    QueryPerformanceFrequency(&freq);
+    const double usPerQpc = 1000000.0 / (double)freq.QuadPart;
+    const int64_t periodQpc = (int64_t)((double)freq.QuadPart / opt.rateHz);
+
+    std::vector<double> tickUs;
+    tickUs.reserve((size_t)tickCount);
+    std::vector<std::vector<double>> stageUs(BackendTickStage_Count);
+    for (auto& v : stageUs) v.reserve((size_t)tickCount);
+
+    wprintf(L"halljoy-bench: pads=%d bound_hids=%zu key_overrides=%zu (unique_curves=%zu) source=%s\n",
+        pads, boundHids.size(), overrides.size(), uniqueCurves,
+        trace.empty() ? L"synthetic" : opt.tracePath.c_str());
+    wprintf(L"  rate=%.0f Hz ticks=%llu budget=%.1f us pacing=%s\n",
+        opt.rateHz, (unsigned long long)tickCount, budgetUs, opt.fast ? L"fast" : L"realtime");
+
+    timeBeginPeriod(1);
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+
+    size_t nextEvent = 0;
+    uint64_t overBudget = 0;
+    const int64_t runStart = QpcNow();
+
+    for (uint64_t i = 0; i < tickCount; ++i)
+    {
+        const double simMs = (double)i * periodMs;
+        if (trace.empty())
+        {
+            ApplySyntheticInputs(boundHids, simMs);
+        }
+        else
+        {
+            while (nextEvent < trace.size() && trace[nextEvent].tMs <= simMs)
+            {
+                const TraceEvent& e = trace[nextEvent++];
+                if (e.hid != 0) BackendSim_SetRawMilli(e.hid, e.rawMilli);
+                else Backend_AddMouseDelta(e.dx, e.dy);
+            }
+        }
+
+        int64_t t0 = QpcNow();
+        Backend_Tick();
+        int64_t t1 = QpcNow();
+
+        double us = (double)(t1 - t0) * usPerQpc;
+        tickUs.push_back(us);
+        if (us > budgetUs) ++overBudget;
+
+        BackendTickProfile prof{};
+        Backend_GetTickProfile(&prof);
+        for (int s = 0; s < BackendTickStage_Count; ++s)
+            stageUs[(size_t)s].push_back(prof.lastStageUs[s]);
+
+        if (measurePrediction)
+            AccumulatePrediction(predStats, timeline, boundHids, simMs, horizonMs);
+
+        if (!opt.fast)
+        {
+            // Same role as the realtime loop's pace timer: paced reports go out
+            // when due, between ticks.
+            const int64_t deadline = runStart + periodQpc * (int64_t)(i + 1);
+            for (;;)
+            {
+                const int64_t now = QpcNow();
+                const int64_t paceDue = Backend_GetPacingDeadlineQpc();
+                if (paceDue != 0 && paceDue <= now)
+                    Backend_FlushPacedReports();
+
+                int64_t left = deadline - now;
+                if (left <= 0) break;
+                if (paceDue != 0 && paceDue < deadline)
+                {
+                    YieldProcessor();
+                    continue;
+                }
+                if ((double)left * usPerQpc > 2000.0) Sleep(1);
+                else YieldProcessor();
+            }
+        }
+    }
+
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL);
+    timeEndPeriod(1);
+
+    BackendTickProfile prof{};
+    Backend_GetTickProfile(&prof);
+    Backend_Shutdown();
+
+    std::vector<double> sorted = tickUs;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (double v : tickUs) sum += v;
+    const double n = (double)tickUs.size();
+
+    wprintf(L"\ntick us: mean=%.2f p50=%.2f p90=%.2f p99=%.2f p99.9=%.2f max=%.2f\n",
+        sum / n,
+        Percentile(sorted, 0.50), Percentile(sorted, 0.90), Percentile(sorted, 0.99),
+        Percentile(sorted, 0.999), sorted.back());
+    wprintf(L"over budget: %llu (%.3f%%)\n",
+        (unsigned long long)overBudget, 100.0 * (double)overBudget / n);
+
+    wprintf(L"\n%-14s %10s %10s %10s %10s %8s\n", L"stage", L"mean_us", L"p50_us", L"p99_us", L"max_us", L"share");
+    double stageSumAll = 0.0;
+    for (int s = 0; s < BackendTickStage_Count; ++s)
+        stageSumAll += prof.totalStageUs[s];
+    for (int s = 0; s < BackendTickStage_Count; ++s)
+    {
+        std::vector<double>& v = stageUs[(size_t)s];
+        std::sort(v.begin(), v.end());
+        wprintf(L"%-14s %10.2f %10.2f %10.2f %10.2f %7.1f%%\n",
+            Backend_GetTickStageName(s),
+            prof.totalStageUs[s] / n,
+            Percentile(v, 0.50), Percentile(v, 0.99), v.empty() ? 0.0 : v.back(),
+            (stageSumAll > 0.0) ? (100.0 * prof.totalStageUs[s] / stageSumAll) : 0.0);
+    }
+
+    const uint64_t built = prof.reportsSent + prof.reportsSuppressed;
+    wprintf(L"\nreports: built=%llu sent=%llu suppressed=%llu (%.1f%% suppressed)\n",
+        (unsigned long long)built,
+        (unsigned long long)prof.reportsSent,
+        (unsigned long long)prof.reportsSuppressed,
+        built ? (100.0 * (double)prof.reportsSuppressed / (double)built) : 0.0);
+    const uint64_t padBuilds = prof.padsRebuilt + prof.padsReused;
+    wprintf(L"pad reports: rebuilt=%llu reused=%llu (%.1f%% reused, inputs unchanged)\n",
+        (unsigned long long)prof.padsRebuilt,
+        (unsigned long long)prof.padsReused,
+        padBuilds ? (100.0 * (double)prof.padsReused / (double)padBuilds) : 0.0);
+
+    static const wchar_t* kPolicyNames[] = { L"exact", L"threshold", L"adaptive" };
+    wprintf(L"\n%-4s %-10s %8s %8s %10s %10s %10s %10s %10s\n",
+        L"pad", L"policy", L"sent", L"flush", L"keepalive", L"held_small", L"held_paced", L"held_same", L"sent/s");
+    for (int p = 0; p < pads; ++p)
+    {
+        BackendPadReportStats ps{};
+        Backend_GetPadReportStats(p, &ps);
+        UINT policy = std::min<UINT>(Settings_GetReportPolicy(p), 2u);
+        wprintf(L"%-4d %-10s %8llu %8llu %10llu %10llu %10llu %10llu %10.1f\n",
+            p + 1, kPolicyNames[policy],
+            (unsigned long long)ps.sent, (unsigned long long)ps.sentFlush,
+            (unsigned long long)ps.sentKeepAlive, (unsigned long long)ps.heldSmall,
+            (unsigned long long)ps.heldPaced, (unsigned long long)ps.heldUnchanged,
+            (double)ps.sent / std::max(opt.seconds, 0.001));
+    }
+
+    wprintf(L"\n%-4s %8s %8s %8s %8s %12s %12s\n",
+        L"pad", L"paced", L"by_timer", L"by_tick", L"dropped", L"late_avg_us", L"late_max_us");
+    for (int p = 0; p < pads; ++p)
+    {
+        BackendPadReportStats ps{};
+        Backend_GetPadReportStats(p, &ps);
+        const uint64_t pacedSent = ps.pacedByTimer + ps.pacedByTick;
+        wprintf(L"%-4d %8llu %8llu %8llu %8llu %12.1f %12llu\n",
+            p + 1,
+            (unsigned long long)ps.pacedDeferred, (unsigned long long)ps.pacedByTimer,
+            (unsigned long long)ps.pacedByTick, (unsigned long long)ps.pacedDropped,
+            pacedSent ? (double)ps.pacedLateUsTotal / (double)pacedSent : 0.0,
+            (unsigned long long)ps.pacedLateUsMax);
+    }
+
+    if (measurePrediction && predStats.samples > 0)
+    {
+        const double ns = (double)predStats.samples;
+        wprintf(L"\nprediction (horizon %.2f ms): samples=%llu extrapolated=%.1f%%\n",
+            horizonMs, (unsigned long long)predStats.samples, 100.0 * (double)predStats.extrapolated / ns);
+        wprintf(L"  mean |error| vs travel %.2f ms ahead: raw=%.4f predicted=%.4f\n",
+            horizonMs, predStats.errRawSum / ns, predStats.errPredSum / ns);
+        wprintf(L"  overshoot: mean=%.4f max=%.4f over_1%%=%llu (%.2f%%)\n",
+            predStats.overshootSum / ns, predStats.overshootMax,
+            (unsigned long long)predStats.overshoots, 100.0 * (double)predStats.overshoots / ns);
+    }
+    else if (Settings_GetInputPrediction() && opt.fast)
+    {
+        wprintf(L"\nprediction: not measured with --fast (needs real-time tick spacing)\n");
+    }
+
+    // Non-zero exit when the p99 tick misses the budget, so scripts can gate on it.
+    return (Percentile(sorted, 0.99) > budgetUs) ? 2 : 0;
+}